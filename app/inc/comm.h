@@ -64,16 +64,23 @@
 void comm_init(void);
 
 //// webgui communication functions
-// sends a message to webgui
-void comm_webgui_send(const char *data, uint32_t data_size);
+// sends a message to webgui and queues its request, the response is delivered to resp_cb (when set)
+// with a timeout the request is async, its callback receives NULL if the response doesn't arrive in time
+// returns the request to wait
+uint32_t comm_webgui_request(const char *data, uint32_t data_size,
+                             void (*resp_cb)(void *data, menu_item_t *item), menu_item_t *item, uint32_t timeout);
+// sends a message to webgui whose response is only consumed, returns the request to wait
+uint32_t comm_webgui_send(const char *data, uint32_t data_size);
 // read a message from webgui
 ringbuff_t* comm_webgui_read(void);
-// sets a function callback to webgui response
-void comm_webgui_set_response_cb(void (*resp_cb)(void *data, menu_item_t *item), menu_item_t *item);
-// invokes the response function callback
+// invokes the response function callback of the oldest request
 void comm_webgui_response_cb(void *data);
-// blocks the execution until the webgui response be received
-void comm_webgui_wait_response(void);
+// blocks the execution until the response of the request, returns zero if it was released without response
+uint8_t comm_webgui_wait_response(uint32_t request);
+// calls with NULL the callbacks of the async messages not answered in time, the late responses are discarded
+void comm_webgui_expire(void);
+// drops the requests waiting their responses, the async callbacks receive NULL
+void comm_webgui_release(void);
 // clear the data in the buffer
 void comm_webgui_clear(void);
 
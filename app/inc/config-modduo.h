@@ -13,7 +13,10 @@
 #define CONFIG_PIN_OUTPUT(port, pin)    GPIO_SetDir((port), (1 << (pin)), GPIO_DIRECTION_OUTPUT)
 #define SET_PIN(port, pin)              GPIO_SetValue((port), (1 << (pin)))
 #define CLR_PIN(port, pin)              GPIO_ClearValue((port), (1 << (pin)))
+#define SET_PINS(port, mask)            GPIO_SetValue((port), (mask))
+#define CLR_PINS(port, mask)            GPIO_ClearValue((port), (mask))
 #define READ_PIN(port, pin)             ((FIO_ReadValue(port) >> (pin)) & 1)
+#define READ_PINS(port)                 FIO_ReadValue(port)
 #define CONFIG_PORT_INPUT(port)         FIO_ByteSetDir((port), 0, 0xFF, GPIO_DIRECTION_INPUT)
 #define CONFIG_PORT_OUTPUT(port)        FIO_ByteSetDir((port), 0, 0xFF, GPIO_DIRECTION_OUTPUT)
 #define WRITE_PORT(port, value)         FIO_ByteSetValue((port), 0, (uint8_t)(value)); \
@@ -52,9 +55,9 @@
 
 //// Hardware peripheral definitions
 // Clock power control
-#define HW_CLK_PWR_CONTROL      CLKPWR_PCONP_PCTIM0 | CLKPWR_PCONP_PCTIM1 | \
+#define HW_CLK_PWR_CONTROL      CLKPWR_PCONP_PCTIM0 | CLKPWR_PCONP_PCTIM1 | CLKPWR_PCONP_PCPWM1 | \
                                 CLKPWR_PCONP_PCUART0 | CLKPWR_PCONP_PCUART1 | \
-                                CLKPWR_PCONP_PCSSP0 |   \
+                                CLKPWR_PCONP_PCSSP0 | CLKPWR_PCONP_PCADC | CLKPWR_PCONP_PCGPDMA | \
                                 CLKPWR_PCONP_PCGPIO
 
 //// Slots count
@@ -96,9 +99,17 @@
                           .rst_port = 0, .rst_pin = 30, \
                           .backlight_port = 1, .backlight_pin = 26 },
 
+// GLCDs backlight PWM
+// the backlight pins are PWM1 outputs: P1.18 is PWM1.1 and P1.26 is PWM1.6
+#define GLCD_BACKLIGHT_PWM_FUNC     2
+#define GLCD0_BACKLIGHT_PWM         1
+#define GLCD1_BACKLIGHT_PWM         6
+// period in microseconds
+#define GLCD_BACKLIGHT_PWM_PERIOD   40
+
 //// Actuators configuration
 // Actuators IDs
-enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
+enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1, EXPRESSION0};
 
 // Amount of footswitches
 #define FOOTSWITCHES_COUNT  SLOTS_COUNT
@@ -113,13 +124,37 @@ enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
 #define ENCODERS_COUNT      SLOTS_COUNT
 
 //total amount of actuators
-#define TOTAL_ACTUATORS (ENCODERS_COUNT + FOOTSWITCHES_COUNT)
+#define TOTAL_ACTUATORS (ENCODERS_COUNT + FOOTSWITCHES_COUNT + EXPRESSIONS_COUNT)
 
 // Encoders ports and pins definitions
 // encoder definition: {ENC_BUTTON_PORT, ENC_BUTTON_PIN, ENC_CHA_PORT, ENC_CHA_PIN, ENC_CHB_PORT, ENC_CHB_PIN}
 #define ENCODER0_PINS       {0, 17, 0, 22, 0, 18}
 #define ENCODER1_PINS       {2, 8, 2, 6, 2, 7}
 
+// Amount of expression pedals
+// the stock board has no expression input, add -DEXPRESSION_INPUT to the Makefile CFLAGS
+// only on the boards which have a pedal wired to P1.31
+#ifdef EXPRESSION_INPUT
+#define EXPRESSIONS_COUNT   1
+#else
+#define EXPRESSIONS_COUNT   0
+#endif
+
+// the arrays indexed by expression keep a slot when there is no pedal, the loops use EXPRESSIONS_COUNT
+#define EXPRESSIONS_SLOTS   ((EXPRESSIONS_COUNT > 0) ? EXPRESSIONS_COUNT : 1)
+
+// Expression pedals ports and pins definitions
+// expression definition: {PORT, PIN, ADC_FUNC, ADC_CHANNEL}
+// P1.31 is AD0.5
+#ifdef EXPRESSION_INPUT
+#define EXPRESSION0_PINS    {1, 31, 3, 5}
+#endif
+
+// ADC conversions per second (burst mode), samples averaged per channel and processing period (ms)
+#define EXPRESSION_ADC_RATE         2000
+#define EXPRESSION_OVERSAMPLING     16
+#define EXPRESSION_SAMPLE_TIME      10
+
 #define SHUTDOWN_BUTTON_PORT    4
 #define SHUTDOWN_BUTTON_PIN     28
 
@@ -135,19 +170,47 @@ enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
 #define WEBGUI_COMM_RX_BUFF_SIZE    4096
 #define WEBGUI_COMM_TX_BUFF_SIZE    512
 
+// maximum time (in ms) webgui takes to answer an async request
+#define WEBGUI_ASYNC_TIMEOUT        100
+// maximum time (in ms) webgui takes to answer a pedalboard load
+#define PEDALBOARD_LOAD_TIMEOUT     10000
+
 //// Tools configuration
 // navigation update time, this is only useful in tool mode
 #define NAVEG_UPDATE_TIME   1500
 
+// pages of banks and pedalboards kept by the navigation
+#define NAVEG_CACHED_PAGES  4
+// items left before the page edge which triggers the prefetch of the next page
+#define NAVEG_PREFETCH_ITEMS    3
+
+// scale points of the paginated controls kept around the encoder step
+#define NAVEG_SCALE_POINTS_WINDOW   32
+// scale points left before the window edge which triggers the request of the next page
+#define NAVEG_SCALE_POINTS_PREFETCH 4
+
+// controls with up to this amount of steps keep a step to value table
+#define NAVEG_STEP_TABLE_MAX    256
+
+// controls addressed to the same encoder kept parsed to switch between them locally, and the heap bytes
+// each ring may hold besides the shown control
+#define NAVEG_CONTROL_RING      8
+#define NAVEG_CONTROL_RING_SIZE (2 * 1024)
+
+// addressing sets of recently used pedalboards kept parsed, and the heap bytes they may hold
+#define NAVEG_UI_CACHE_SETS     4
+#define NAVEG_UI_CACHE_SIZE     (4 * 1024)
+
 // time in milliseconds to enter in tool mode (hold rotary encoder button)
 #define TOOL_MODE_TIME      500
 
 // the amount of pulses from the encoder that is equal to one up/down movement in a menu
 #define SCROL_SENSITIVITY   0
 
-#define ENCODER_ACCEL_STEP_1 2
-#define ENCODER_ACCEL_STEP_2 3
-#define ENCODER_ACCEL_STEP_3 5
+// encoders acceleration: detents faster than ENCODER_ACCEL_SLOW_TIME (in milliseconds) move the
+// controls by (ENCODER_ACCEL_SLOW_TIME / interval)^2 steps, up to ENCODER_ACCEL_MAX steps
+#define ENCODER_ACCEL_SLOW_TIME     60
+#define ENCODER_ACCEL_MAX           32
 
 // which display will show which tool
 #define DISPLAY_TOOL_SYSTEM         0
@@ -161,6 +224,8 @@ enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
 #define SCREEN_ROTARY_DEFAULT_NAME      "ENDLESS KNOB #"
 // defines the default foot text
 #define SCREEN_FOOT_DEFAULT_NAME        "FOOT #"
+// maximum refresh rate of each display, update requests above this rate are coalesced
+#define DISPLAY_MAX_FPS                 30
 
 //// System menu configuration
 // includes the system menu callbacks
@@ -322,6 +387,8 @@ enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
     {HP_CV_OUTP+1, "Set output to CV", HP_CV_POPUP_TXT}, \
 
 #define MENU_LINE_CHARS     31
+// size of the menu item names, a whole line and its terminator
+#define MAX_CHARS_MENU_NAME (MENU_LINE_CHARS + 1)
 
 //// Foot functions leds colors
 #define TOGGLED_COLOR               GREEN
@@ -355,6 +422,8 @@ enum {ENCODER0, ENCODER1, FOOTSWITCH0, FOOTSWITCH1};
 #define TAP_TEMPO_TAP_HYSTERESIS 100
 // defines the time (in milliseconds) that the tap can be over the maximum value to be registered
 #define TAP_TEMPO_MAXVAL_OVERFLOW 50
+// defines the amount of taps used to estimate the tempo
+#define TAP_TEMPO_TAPS          8
 
 //// Toggled
 // defines the toggled footer text
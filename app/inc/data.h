@@ -58,12 +58,19 @@ typedef struct CONTROL_T {
     scale_point_t **scale_points;
     uint16_t scale_point_index;
     uint8_t scroll_dir;
+    // scaled integer range of the linear and logarithmic stepping, decimals is FIXED_NONE when it steps in float
+    int32_t fixed_value, fixed_minimum, fixed_maximum;
+    int64_t fixed_step;
+    int32_t *fixed_table;
+    uint8_t decimals;
 } control_t;
 
 typedef struct BP_LIST_T {
     char **names, **uids;
     uint16_t hover, selected;
     uint16_t page_min, page_max, menu_max;
+    uint16_t count;
+    uint32_t serial;
 } bp_list_t;
 
 typedef struct BANK_CONFIG_T {
@@ -124,6 +131,7 @@ typedef struct MENU_POPUP_T {
 
 control_t * data_parse_control(char **data);
 void data_free_control(control_t *control);
+uint32_t data_control_size(control_t *control);
 bp_list_t *data_parse_banks_list(char **list_data, uint32_t list_count);
 void data_free_banks_list(bp_list_t *bp_list);
 bp_list_t *data_parse_pedalboards_list(char **list_data, uint32_t list_count);
@@ -71,6 +71,13 @@ typedef struct LISTBOX_T {
     const char *name;
 } listbox_t;
 
+// state of the last listbox render, used to redraw only the changed lines
+typedef struct LISTBOX_VIEW_T {
+    uint8_t valid;
+    char** list;
+    uint8_t count, selected, hover, first_line;
+} listbox_view_t;
+
 typedef struct BAR_T {
     uint8_t x, y;
     uint8_t color;
@@ -130,6 +137,7 @@ typedef struct POPUP_T {
 //widgets
 void widget_textbox(glcd_t *display, textbox_t *textbox);
 void widget_listbox(glcd_t *display, listbox_t *listbox);
+void widget_listbox_view(glcd_t *display, listbox_t *listbox, listbox_view_t *view);
 void widget_listbox2(glcd_t *display, listbox_t *listbox);
 void widget_listbox4(glcd_t *display, listbox_t *listbox);
 void widget_bar(glcd_t *display, bar_t *bar);
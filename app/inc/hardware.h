@@ -81,6 +81,8 @@ led_t *hardware_leds(uint8_t led_id);
 void *hardware_actuators(uint8_t actuator_id);
 // returns the timestamp (a variable increment in each millisecond)
 uint32_t hardware_timestamp(void);
+// returns the count of a free running timer in microseconds, it wraps around each 71 minutes
+uint32_t hardware_timestamp_us(void);
 // turn on/off coreboard
 void hardware_coreboard_power(uint8_t state);
 
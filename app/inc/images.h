@@ -3,6 +3,8 @@
 #ifndef IMAGES_H
 #define IMAGES_H
 
+// images are stored in the compressed format (see glcd draw_image_rle)
 extern const uint8_t mod_logo[], mod_duo[];
+extern const uint16_t mod_logo_size, mod_duo_size;
 
 #endif
@@ -51,9 +51,8 @@ enum {UI_DISCONNECTED, UI_CONNECTED};
 *           GLOBAL VARIABLES
 ************************************************************************************************************************
 */
-bool g_should_wait_for_webgui;
-bool g_protocol_busy;
-bool g_ui_communication_started;
+extern bool g_should_wait_for_webgui;
+extern bool g_ui_communication_started;
 /*
 ************************************************************************************************************************
 *           MACRO'S
@@ -77,22 +76,35 @@ void naveg_ui_connection(uint8_t status);
 void naveg_add_control(control_t *control, uint8_t protocol);
 // removes the control from controls list
 void naveg_remove_control(uint8_t hw_id);
-// increment the control value
-void naveg_inc_control(uint8_t display);
-// decrement the control value
-void naveg_dec_control(uint8_t display);
+// increment the control value, steps > 1 is used by the encoders acceleration on linear controls
+void naveg_inc_control(uint8_t display, uint8_t steps);
+// decrement the control value, steps > 1 is used by the encoders acceleration on linear controls
+void naveg_dec_control(uint8_t display, uint8_t steps);
 // sets the control value
 void naveg_set_control(uint8_t hw_id, float value);
+// replaces the step to value table of the encoder control by a custom curve, returns 0 if it can't be used
+uint8_t naveg_set_control_table(uint8_t hw_id, char **values, uint32_t count);
 // gets the control value
 float naveg_get_control(uint8_t hw_id);
+// hash of the current assignments of the actuators and bank functions, a non NULL uid tags them to the pedalboard
+uint32_t naveg_ui_state_hash(const char *uid);
+// detaches all controls caching them for naveg_ui_state_restore, the actuators are shown as unassigned
+void naveg_ui_state_snapshot(void);
+// restores cached controls of the pedalboard uid, or of any one if NULL, when the hash matches
+// values is a list of hw_id and value pairs
+uint8_t naveg_ui_state_restore(const char *uid, uint32_t hash, char **values, uint32_t count);
 // change the foot value
 void naveg_foot_change(uint8_t foot, uint8_t pressed);
+// moves the control assigned to the expression pedal, value goes from 0 to EXPRESSION_MAX_VALUE
+void naveg_expression_change(uint8_t expression, uint16_t value);
 // request the next control of the display
 void naveg_next_control(uint8_t display);
 // toggle between control and tool
 void naveg_toggle_tool(uint8_t tool, uint8_t display);
 // returns if display is in tool mode
 uint8_t naveg_is_tool_mode(uint8_t display);
+// changes whenever a tool is turned on or off
+uint32_t naveg_tools_serial(void);
 //toggle / set master volume 
 void naveg_master_volume(uint8_t set);
 //increments the mater volume
@@ -121,6 +133,10 @@ void naveg_reset_menu(void);
 void naveg_update(void);
 int naveg_need_update(void);
 
+// handles the webgui responses recorded by the protocol task, runs on the actuators task
+void naveg_process_responses(void);
+int naveg_responses_pending(void);
+
 void naveg_set_active_pedalboard(uint8_t pedalboard_index);
 void naveg_set_pb_list_update(void);
 bool naveg_get_pb_list_update(void);
@@ -39,6 +39,44 @@
 // special "flag" to indicate banks control (last available bitmask value for a 16bit integer)
 #define FLAG_CONTROL_BANKS 0x4000
 
+// commands handled by this firmware which may not be defined yet by mod-controller-proto
+#ifndef CMD_GLCD_DRAW_RLE
+#define CMD_GLCD_DRAW_RLE   "glcd_draw_rle %i %i %i %s"
+#endif
+// led_anim <led> <repeat> <r> <g> <b> <fade_ms> <hold_ms> [<r> <g> <b> <fade_ms> <hold_ms> ...]
+#ifndef CMD_LED_ANIMATION
+#define CMD_LED_ANIMATION   "led_anim %i %i %i %i %i %i %i ..."
+#endif
+// control_table <hw_id> <value of step 0> <value of step 1> ...
+#ifndef CMD_CONTROL_TABLE
+#define CMD_CONTROL_TABLE   "control_table %i %f %f ..."
+#endif
+// control_set_multi <hw_id> <value> [<hw_id> <value> ...]
+#ifndef CMD_CONTROL_SET_MULTI
+#define CMD_CONTROL_SET_MULTI   "control_set_multi %i %f ..."
+#endif
+// ui_state [<pedalboard uid>], responds with the hash of the assignments
+#ifndef CMD_UI_STATE
+#define CMD_UI_STATE   "ui_state ..."
+#endif
+// ui_state_restore <hash> [<hw_id> <value> ...]
+#ifndef CMD_UI_STATE_RESTORE
+#define CMD_UI_STATE_RESTORE   "ui_state_restore %i ..."
+#endif
+// ui_state_load <pedalboard uid> <hash> [<hw_id> <value> ...]
+#ifndef CMD_UI_STATE_LOAD
+#define CMD_UI_STATE_LOAD   "ui_state_load %s %i ..."
+#endif
+
+// amount of commands registered in addition to the ones counted by COMMAND_COUNT_DUO
+#define PROTOCOL_EXTRA_COMMANDS     7
+
+// owners of the webgui link, each one counts its holds on its own 5 bits of the link state word
+// the navigation takes the link from the actuators and the protocol tasks, one unlock only drops one hold
+#define LINK_OWNER_PARSER       0x0001      // protocol task handling a message received from webgui
+#define LINK_OWNER_CALLBACK     0x0020      // protocol callback changing the controller state
+#define LINK_OWNER_NAVEG        0x0400      // navigation waiting the response of a request
+
 /*
 ************************************************************************************************************************
 *           DATA TYPES
@@ -74,6 +112,12 @@ typedef struct MSG_T {
 ************************************************************************************************************************
 */
 
+// link state word: holds of the owners on the low 15 bits, timestamp (ms) of when the link was taken on the upper bits
+#define LINK_HOLDS_MAX              0x1F
+#define LINK_HOLDS(state, owner)    (((state) / (owner)) & LINK_HOLDS_MAX)
+#define LINK_OWNERS(state)          ((state) & 0x7FFF)
+#define LINK_SINCE(state)           ((state) >> 15)
+
 
 /*
 ************************************************************************************************************************
@@ -85,19 +129,30 @@ void protocol_parse(msg_t *msg);
 void protocol_add_command(const char *command, void (*callback)(proto_t *proto));
 void protocol_response(const char *response, proto_t *proto);
 void protocol_remove_commands(void);
+void protocol_lock(uint32_t owner);
+void protocol_unlock(uint32_t owner);
+uint32_t protocol_link_state(void);
+uint8_t protocol_busy(void);
 
 void cb_ping(proto_t *proto);
 void cb_say(proto_t *proto);
 void cb_led(proto_t *proto);
+void cb_led_animation(proto_t *proto);
 void cb_glcd_text(proto_t *proto);
 void cb_glcd_dialog(proto_t *proto);
 void cb_glcd_draw(proto_t *proto);
+void cb_glcd_draw_rle(proto_t *proto);
 void cb_gui_connection(proto_t *proto);
 void cb_disp_brightness(proto_t *proto);
 void cb_control_add(proto_t *proto);
 void cb_control_rm(proto_t *proto);
 void cb_control_set(proto_t *proto);
+void cb_control_set_multi(proto_t *proto);
+void cb_control_table(proto_t *proto);
 void cb_control_get(proto_t *proto);
+void cb_ui_state(proto_t *proto);
+void cb_ui_state_restore(proto_t *proto);
+void cb_ui_state_load(proto_t *proto);
 void cb_control_set_index(proto_t *proto);
 void cb_initial_state(proto_t *proto);
 void cb_bank_config(proto_t *proto);
@@ -61,7 +61,6 @@
 */
 
 // system menu callbacks
-void system_lock_comm_serial(bool busy);
 void system_update_menu_value(uint8_t item_ID, uint16_t value);
 uint8_t system_get_current_profile(void);
 void system_true_bypass_cb(void *arg, int event);
@@ -0,0 +1,86 @@
+/*
+************************************************************************************************************************
+*
+************************************************************************************************************************
+*/
+
+#ifndef TAP_TEMPO_H
+#define TAP_TEMPO_H
+
+
+/*
+************************************************************************************************************************
+*           INCLUDE FILES
+************************************************************************************************************************
+*/
+
+#include <stdint.h>
+#include "config.h"
+
+
+/*
+************************************************************************************************************************
+*           DO NOT CHANGE THESE DEFINES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           CONFIGURATION DEFINES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           DATA TYPES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           GLOBAL VARIABLES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           MACRO'S
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+// the times are in microseconds, the taps of each footswitch are estimated independently
+// tap_tempo_press: keeps the time of the press being handled, called for each press event whatever handles it
+void tap_tempo_press(uint8_t foot, uint32_t time_us);
+// tap_tempo_reset: forgets the taps of the footswitch
+void tap_tempo_reset(uint8_t foot);
+// tap_tempo_tap: adds the press taken as a tap and returns the estimated period, zero while there is no estimation
+uint32_t tap_tempo_tap(uint8_t foot, uint32_t max_us);
+// tap_tempo_phase: returns the time elapsed since the last estimated beat, in the range of the period
+uint32_t tap_tempo_phase(uint8_t foot, uint32_t period_us);
+
+
+/*
+************************************************************************************************************************
+*           CONFIGURATION ERRORS
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           END HEADER
+************************************************************************************************************************
+*/
+
+#endif
@@ -35,6 +35,11 @@
 // uncomment the define below to enable the quotation marks evaluation on strarr_split parser
 #define ENABLE_QUOTATION_MARKS
 
+// maximum decimal places kept by the scaled integers of the fixed-point functions
+#define FIXED_DECIMALS_MAX      6
+// returned by fixed_decimals when the range doesn't fit in a scaled integer
+#define FIXED_NONE              0xFF
+
 
 /*
 ************************************************************************************************************************
@@ -48,6 +53,12 @@ typedef struct RINGBUFF_T {
     uint32_t size;
 } ringbuff_t;
 
+// string builder over a fixed size buffer, keeps the length to avoid strlen/strcat scans
+typedef struct STRBUF_T {
+    char *buffer;
+    uint32_t size, length;
+} strbuf_t;
+
 
 /*
 ************************************************************************************************************************
@@ -82,8 +93,30 @@ uint32_t int_to_str(int32_t num, char *string, uint32_t string_size, uint8_t zer
 // converts float to string  and returns the string length
 uint32_t float_to_str(float num, char *string, uint32_t string_size, uint8_t precision);
 
+// fixed-point functions, the values are scaled integers in units of 10^-decimals
+// fixed_decimals: returns the most decimals with which both limits fit in 30 bits, or FIXED_NONE
+uint8_t fixed_decimals(float minimum, float maximum);
+// float_to_fixed/fixed_to_float: converts between float and a scaled integer
+int32_t float_to_fixed(float num, uint8_t decimals);
+float fixed_to_float(int32_t num, uint8_t decimals);
+// fixed_to_str: converts a scaled integer to string without float operations and returns the string length
+uint32_t fixed_to_str(int32_t num, uint8_t decimals, char *string, uint32_t string_size, uint8_t precision);
+// fixed_log2: returns log2 of num in Q16.16
+int32_t fixed_log2(uint32_t num);
+// fixed_exp2: returns 2 raised to num (Q16.16) as a rounded integer, saturated to 32 bits
+uint32_t fixed_exp2(int32_t num);
+
 // duplicate a string (alternative to strdup)
 char *str_duplicate(const char *str);
+
+// string builder functions, the buffer is always kept null terminated and
+// the text is truncated when the buffer is full
+// strbuf_init: starts an empty string on buffer
+void strbuf_init(strbuf_t *sb, char *buffer, uint32_t size);
+// strbuf_append: appends a string, returns the new length
+uint32_t strbuf_append(strbuf_t *sb, const char *str);
+// strbuf_fill: appends the char c until the string reaches length, returns the new length
+uint32_t strbuf_fill(strbuf_t *sb, char c, uint32_t length);
 // handy function to make a copy of a C-string array (char**)
 char** str_array_duplicate(char** list, uint16_t count);
 // free memory allocated with `str_array_duplicate`
@@ -13,6 +13,7 @@
 
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "task.h"
 /*
 ************************************************************************************************************************
 *           LOCAL DEFINES
@@ -20,6 +21,8 @@
 */
 
 #define WEBGUI_MAX_SEM_COUNT   5
+// must be a power of 2
+#define WEBGUI_MAX_REQUESTS    8
 
 
 /*
@@ -35,6 +38,14 @@
 ************************************************************************************************************************
 */
 
+// a request waiting its response, webgui answers the requests in the order they were sent
+typedef struct WEBGUI_REQUEST_T {
+    void (*resp_cb)(void *data, menu_item_t *item);
+    menu_item_t *item;
+    portTickType deadline;
+    uint8_t async;
+} webgui_request_t;
+
 
 /*
 ************************************************************************************************************************
@@ -49,10 +60,13 @@
 ************************************************************************************************************************
 */
 
-static  void (*g_webgui_response_cb)(void *data, menu_item_t *item) = NULL;
-static  menu_item_t *g_current_item;
-static volatile uint8_t  g_webgui_blocked;
+static webgui_request_t g_requests[WEBGUI_MAX_REQUESTS];
+static volatile uint32_t g_requests_head, g_requests_tail;
+// requests dropped without response by the last release, [first, last)
+static volatile uint32_t g_released_first, g_released_last;
 static volatile xSemaphoreHandle g_webgui_sem = NULL;
+// keeps the requests in the order their messages are sent
+static xSemaphoreHandle g_webgui_send_mutex = NULL;
 static  ringbuff_t *g_webgui_rx_rb;
 
 
@@ -76,6 +90,53 @@ static  ringbuff_t *g_webgui_rx_rb;
 ************************************************************************************************************************
 */
 
+static uint32_t request_push(void (*resp_cb)(void *data, menu_item_t *item), menu_item_t *item, uint32_t timeout)
+{
+    uint32_t seq;
+
+    // the requests queued are answered or expired by the other tasks
+    while ((g_requests_head - g_requests_tail) >= WEBGUI_MAX_REQUESTS)
+        vTaskDelay(1);
+
+    taskENTER_CRITICAL();
+    seq = g_requests_head;
+    webgui_request_t *request = &g_requests[seq & (WEBGUI_MAX_REQUESTS - 1)];
+    request->resp_cb = resp_cb;
+    request->item = item;
+    request->deadline = xTaskGetTickCount() + (timeout / portTICK_RATE_MS);
+    request->async = (timeout > 0);
+    g_requests_head = seq + 1;
+    taskEXIT_CRITICAL();
+
+    return seq;
+}
+
+// the async callbacks are called without data, only the ones past the deadline unless all is set
+static void requests_release(uint8_t all)
+{
+    uint32_t seq;
+
+    for (seq = g_requests_tail; (int32_t) (g_requests_head - seq) > 0; seq++)
+    {
+        void (*resp_cb)(void *data, menu_item_t *item) = NULL;
+        menu_item_t *item = NULL;
+
+        // the late response is still consumed by its request
+        taskENTER_CRITICAL();
+        webgui_request_t *request = &g_requests[seq & (WEBGUI_MAX_REQUESTS - 1)];
+        if ((int32_t) (seq - g_requests_tail) >= 0 && request->async &&
+            (all || (int32_t) (request->deadline - xTaskGetTickCount()) <= 0))
+        {
+            resp_cb = request->resp_cb;
+            item = request->item;
+            request->resp_cb = NULL;
+        }
+        taskEXIT_CRITICAL();
+
+        if (resp_cb) resp_cb(NULL, item);
+    }
+}
+
 static void webgui_rx_cb(serial_t *serial)
 {
     uint8_t buffer[SERIAL_MAX_RX_BUFF_SIZE] = {};
@@ -109,14 +170,29 @@ static void webgui_rx_cb(serial_t *serial)
 void comm_init(void)
 {
     g_webgui_sem = xSemaphoreCreateCounting(WEBGUI_MAX_SEM_COUNT, 0);
+    g_webgui_send_mutex = xSemaphoreCreateMutex();
     g_webgui_rx_rb = ringbuff_create(WEBGUI_COMM_RX_BUFF_SIZE);
 
     serial_set_callback(WEBGUI_SERIAL, webgui_rx_cb);
 }
 
-void comm_webgui_send(const char *data, uint32_t data_size)
+uint32_t comm_webgui_request(const char *data, uint32_t data_size,
+                             void (*resp_cb)(void *data, menu_item_t *item), menu_item_t *item, uint32_t timeout)
 {
+    uint32_t request;
+
+    // webgui answers the messages in the order they are received
+    xSemaphoreTake(g_webgui_send_mutex, portMAX_DELAY);
+    request = request_push(resp_cb, item, timeout);
     serial_send(WEBGUI_SERIAL, (const uint8_t*)data, data_size+1);
+    xSemaphoreGive(g_webgui_send_mutex);
+
+    return request;
+}
+
+uint32_t comm_webgui_send(const char *data, uint32_t data_size)
+{
+    return comm_webgui_request(data, data_size, NULL, NULL, 0);
 }
 
 ringbuff_t* comm_webgui_read(void)
@@ -129,27 +205,58 @@ ringbuff_t* comm_webgui_read(void)
     return NULL;
 }
 
-void comm_webgui_set_response_cb(void (*resp_cb)(void *data, menu_item_t *item), menu_item_t *item)
-{
-    g_current_item = item;
-    g_webgui_response_cb = resp_cb;
-}
-
 void comm_webgui_response_cb(void *data)
 {
-    if (g_webgui_response_cb)
+    void (*resp_cb)(void *data, menu_item_t *item);
+    menu_item_t *item;
+
+    taskENTER_CRITICAL();
+    if (g_requests_tail == g_requests_head)
     {
-        g_webgui_response_cb(data, g_current_item);
-        g_webgui_response_cb = NULL;
+        taskEXIT_CRITICAL();
+        return;
     }
 
-    g_webgui_blocked = 0;
+    // an expired request already had its callback called, its late response is only consumed
+    webgui_request_t *request = &g_requests[g_requests_tail & (WEBGUI_MAX_REQUESTS - 1)];
+    resp_cb = request->resp_cb;
+    item = request->item;
+    request->resp_cb = NULL;
+    taskEXIT_CRITICAL();
+
+    if (resp_cb) resp_cb(data, item);
+
+    // the queue may have been cleared meanwhile
+    taskENTER_CRITICAL();
+    if (g_requests_tail != g_requests_head) g_requests_tail++;
+    taskEXIT_CRITICAL();
+}
+
+uint8_t comm_webgui_wait_response(uint32_t request)
+{
+    // the other tasks keep running while the responses of the requests sent before arrive
+    while ((int32_t) (g_requests_tail - request) <= 0)
+        vTaskDelay(1);
+
+    // a released request had no response, its callback wasn't called
+    return ((request - g_released_first) >= (g_released_last - g_released_first));
+}
+
+void comm_webgui_expire(void)
+{
+    requests_release(0);
 }
 
-void comm_webgui_wait_response(void)
+void comm_webgui_release(void)
 {
-    g_webgui_blocked = 1;
-    while (g_webgui_blocked);
+    requests_release(1);
+
+    // the waiting requests are released
+    taskENTER_CRITICAL();
+    g_released_first = g_requests_tail;
+    g_released_last = g_requests_head;
+    g_requests_tail = g_requests_head;
+    taskEXIT_CRITICAL();
 }
 
 //clear the ringbuffer
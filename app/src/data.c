@@ -49,6 +49,8 @@ static char g_back_to_bank[] = {"< Back to bank list"};
 ************************************************************************************************************************
 */
 
+// distinguishes the parsed lists even when the allocator reuses their addresses
+static uint32_t g_bp_list_serial;
 
 /*
 ************************************************************************************************************************
@@ -105,6 +107,8 @@ control_t *data_parse_control(char **data)
     control->scale_points_flag = 1;
     control->scale_point_index = 0;
     control->scale_points = NULL;
+    control->decimals = FIXED_NONE;
+    control->fixed_table = NULL;
 
     // checks the memory allocation
     if (!control->label || !control->unit)
@@ -165,10 +169,39 @@ void data_free_control(control_t *control)
         FREE(control->scale_points);
     }
 
+    FREE(control->fixed_table);
     FREE(control);
     return;
 }
 
+uint32_t data_control_size(control_t *control)
+{
+    if (!control) return 0;
+
+    uint32_t size = sizeof(control_t);
+
+    if (control->label) size += strlen(control->label) + 1;
+    if (control->unit) size += strlen(control->unit) + 1;
+
+    if (control->scale_points)
+    {
+        uint8_t i;
+        size += sizeof(scale_point_t *) * control->scale_points_count;
+        for (i = 0; i < control->scale_points_count; i++)
+        {
+            if (control->scale_points[i])
+            {
+                size += sizeof(scale_point_t);
+                if (control->scale_points[i]->label) size += strlen(control->scale_points[i]->label) + 1;
+            }
+        }
+    }
+
+    if (control->fixed_table) size += sizeof(int32_t) * control->steps;
+
+    return size;
+}
+
 bp_list_t *data_parse_banks_list(char **list_data, uint32_t list_count)
 {
     if (!list_data || list_count == 0 || (list_count % 2)) return NULL;
@@ -181,6 +214,7 @@ bp_list_t *data_parse_banks_list(char **list_data, uint32_t list_count)
 
     // clear allocated memory
     memset(bp_list, 0, sizeof(bp_list_t));
+    bp_list->serial = ++g_bp_list_serial;
 
     // allocate string arrays
     const size_t list_size = sizeof(char *) * (list_count + 1);
@@ -202,6 +236,7 @@ bp_list_t *data_parse_banks_list(char **list_data, uint32_t list_count)
 
         // check memory allocation
         if (!bp_list->names[j] || !bp_list->uids[j]) goto error;
+        bp_list->count = j + 1;
     }
 
     return bp_list;
@@ -249,6 +284,7 @@ bp_list_t *data_parse_pedalboards_list(char **list_data, uint32_t list_count)
 
     // clear allocated memory
     memset(bp_list, 0, sizeof(bp_list_t));
+    bp_list->serial = ++g_bp_list_serial;
 
     // allocate string arrays
     const size_t list_size = sizeof(char *) * (list_count + 1);
@@ -265,6 +301,7 @@ bp_list_t *data_parse_pedalboards_list(char **list_data, uint32_t list_count)
     // first line is 'back to banks list'
     bp_list->names[0] = g_back_to_bank;
     bp_list->uids[0] = NULL;
+    bp_list->count = 1;
 
     // fill the bp_list struct
     for (uint32_t i = 0, j = 1; list_data[i] && j < list_count; i += 2, j++)
@@ -274,6 +311,7 @@ bp_list_t *data_parse_pedalboards_list(char **list_data, uint32_t list_count)
 
         // check memory allocation
         if (!bp_list->names[j] || !bp_list->uids[j]) goto error;
+        bp_list->count = j + 1;
     }
 
     return bp_list;
@@ -7,6 +7,9 @@
 
 #include "glcd_widget.h"
 #include "utils.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
 
 #include <math.h>
 #include <string.h>
@@ -24,6 +27,11 @@
 #define GRAPH_NUM_BARS      sizeof(GraphLinTable)
 #define GRAPH_V_NUM_BARS    sizeof(GraphVTable)
 
+// text layout cache
+#define TEXT_LAYOUT_CACHE_SIZE  8
+#define TEXT_LAYOUT_MAX_LINES   ((DISPLAY_HEIGHT / 6) + 1)
+#define TEXT_LAYOUT_WRITING     0x80
+
 
 /*
 ************************************************************************************************************************
@@ -37,6 +45,24 @@
 ************************************************************************************************************************
 */
 
+typedef struct TEXT_LINE_T {
+    uint16_t start;
+    uint8_t length;
+} text_line_t;
+
+// measured width and line breaks of a text, as drawn by widget_textbox
+// users counts the widgets drawing from it, TEXT_LAYOUT_WRITING is set while it's rebuilt
+typedef struct TEXT_LAYOUT_T {
+    volatile uint8_t users;
+    const uint8_t *font;
+    uint32_t hash;
+    uint16_t length;
+    uint8_t box_width, box_height;
+    text_mode_t mode;
+    uint8_t width, lines_count;
+    text_line_t lines[TEXT_LAYOUT_MAX_LINES];
+} text_layout_t;
+
 
 /*
 ************************************************************************************************************************
@@ -54,6 +80,9 @@
 ************************************************************************************************************************
 */
 
+static text_layout_t g_text_layouts[TEXT_LAYOUT_CACHE_SIZE];
+static uint8_t g_text_layouts_next;
+
 
 /*
 ************************************************************************************************************************
@@ -102,6 +131,201 @@ static uint8_t get_text_width(const char *text, const uint8_t *font)
     return text_width;
 }
 
+static uint8_t get_char_width(char c, const uint8_t *font)
+{
+    if (FONT_IS_MONO_SPACED(font)) return font[FONT_FIXED_WIDTH];
+    return font[FONT_WIDTH_TABLE + (c - font[FONT_FIRST_CHAR])];
+}
+
+// splits the text in lines the same way they are drawn
+static void text_layout_build(text_layout_t *layout, const char *text)
+{
+    const uint8_t *font = layout->font;
+    uint16_t pos = 0, start = 0;
+    uint8_t i = 0, text_width = 0, text_height = 0;
+
+    // single lines without defined width take the whole text width
+    uint8_t max_width = layout->box_width;
+    if (max_width == 0 && layout->mode == TEXT_SINGLE_LINE) max_width = layout->width;
+
+    layout->lines_count = 0;
+
+    while (text[pos])
+    {
+        text_width += get_char_width(text[pos], font) + FONT_INTERCHAR_SPACE;
+        i++;
+
+        // checks the width limit
+        if (text_width >= max_width || text[pos] == '\n')
+        {
+            if (text[pos] == '\n') pos++;
+
+            // check whether is single line
+            if (layout->mode == TEXT_SINGLE_LINE) break;
+
+            if (layout->lines_count < TEXT_LAYOUT_MAX_LINES)
+            {
+                layout->lines[layout->lines_count].start = start;
+                layout->lines[layout->lines_count].length = i - 1;
+                layout->lines_count++;
+            }
+
+            text_height += font[FONT_HEIGHT] + 1;
+            text_width = 0;
+            i = 0;
+            start = pos;
+
+            // checks the height limit
+            if (text_height > layout->box_height) break;
+        }
+        else pos++;
+    }
+
+    // last line
+    if (text_width > 0 && layout->lines_count < TEXT_LAYOUT_MAX_LINES)
+    {
+        // the char which crossed the width limit is dropped
+        if ((text_width - FONT_INTERCHAR_SPACE) > max_width) i--;
+
+        layout->lines[layout->lines_count].start = start;
+        layout->lines[layout->lines_count].length = i;
+        layout->lines_count++;
+    }
+}
+
+// widgets are drawn from several tasks, a layout isn't rebuilt while another one draws from it
+static uint8_t text_layout_acquire(text_layout_t *layout)
+{
+    uint8_t acquired = 0;
+
+    taskENTER_CRITICAL();
+    if (!(layout->users & TEXT_LAYOUT_WRITING))
+    {
+        layout->users++;
+        acquired = 1;
+    }
+    taskEXIT_CRITICAL();
+
+    return acquired;
+}
+
+static void text_layout_release(text_layout_t *layout)
+{
+    taskENTER_CRITICAL();
+    layout->users--;
+    taskEXIT_CRITICAL();
+}
+
+// claims the next layout nobody draws from for writing, NULL if all of them are in use
+static text_layout_t *text_layout_evict(void)
+{
+    uint8_t i, index;
+    text_layout_t *layout = NULL;
+
+    taskENTER_CRITICAL();
+    for (i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        index = (g_text_layouts_next + i) % TEXT_LAYOUT_CACHE_SIZE;
+        if (g_text_layouts[index].users == 0)
+        {
+            layout = &g_text_layouts[index];
+            layout->users = TEXT_LAYOUT_WRITING;
+            g_text_layouts_next = (index + 1) % TEXT_LAYOUT_CACHE_SIZE;
+            break;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return layout;
+}
+
+// returns the acquired layout of the text, measuring it only if it isn't cached
+static text_layout_t *text_layout_get(const uint8_t *font, text_mode_t mode, uint8_t box_width, uint8_t box_height,
+                                      const char *text)
+{
+    uint8_t i;
+    uint32_t hash = 2166136261u;
+    const char *ptext = text;
+    text_layout_t *layout;
+
+    // FNV-1a hash, a single walk instead of measuring and splitting the text
+    while (*ptext) hash = (hash ^ (uint8_t) *ptext++) * 16777619u;
+
+    for (i = 0; i < TEXT_LAYOUT_CACHE_SIZE; i++)
+    {
+        layout = &g_text_layouts[i];
+        if (!text_layout_acquire(layout)) continue;
+
+        if (layout->font == font && layout->hash == hash && layout->length == (ptext - text) &&
+            layout->mode == mode && layout->box_width == box_width &&
+            (mode == TEXT_SINGLE_LINE || layout->box_height == box_height))
+            return layout;
+
+        text_layout_release(layout);
+    }
+
+    // there are more layouts than tasks drawing, the wait is only a safeguard
+    while (!(layout = text_layout_evict())) vTaskDelay(1);
+
+    layout->font = font;
+    layout->hash = hash;
+    layout->length = ptext - text;
+    layout->mode = mode;
+    layout->box_width = box_width;
+    layout->box_height = box_height;
+
+    // width of the whole text, used to align single lines
+    layout->width = get_text_width(text, font);
+    text_layout_build(layout, text);
+
+    // the writer becomes the only user
+    taskENTER_CRITICAL();
+    layout->users = 1;
+    taskEXIT_CRITICAL();
+
+    return layout;
+}
+
+static void listbox_layout(listbox_t *listbox, uint8_t *max_lines, uint8_t *first_line)
+{
+    uint8_t center_focus;
+
+    *max_lines = listbox->height / (listbox->font[FONT_HEIGHT] + listbox->line_space);
+
+    center_focus = (*max_lines / 2) - (1 - (*max_lines % 2));
+    *first_line = 0;
+
+    if (listbox->hover > center_focus && listbox->count > *max_lines)
+    {
+        *first_line = listbox->hover - center_focus;
+        if (*first_line > ABS(listbox->count - *max_lines))
+        {
+            *first_line = ABS(listbox->count - *max_lines);
+        }
+    }
+
+    if (*max_lines > listbox->count) *max_lines = listbox->count;
+}
+
+static void listbox_draw_line(glcd_t *display, listbox_t *listbox, uint8_t index, uint8_t y_line)
+{
+    char aux[DISPLAY_WIDTH/2];
+    const char *line_txt = listbox->list[index];
+
+    if (index == listbox->selected)
+    {
+        uint8_t j = 0;
+        aux[j++] = ' ';
+        aux[j++] = '>';
+        aux[j++] = ' ';
+        while (*line_txt && j < sizeof(aux)-1) aux[j++] = *line_txt++;
+        aux[j] = 0;
+        line_txt = aux;
+    }
+
+    glcd_text(display, listbox->x + listbox->text_left_margin, y_line, line_txt, listbox->font, listbox->color);
+}
+
 
 /*
 ************************************************************************************************************************
@@ -112,12 +336,15 @@ static uint8_t get_text_width(const char *text, const uint8_t *font)
 void widget_textbox(glcd_t *display, textbox_t *textbox)
 {
     uint8_t text_width, text_height;
+    text_layout_t *layout;
 
     if (textbox->text == NULL) return;
 
+    layout = text_layout_get(textbox->font, textbox->mode, textbox->width, textbox->height, textbox->text);
+
     if (textbox->mode == TEXT_SINGLE_LINE)
     {
-        text_width = get_text_width(textbox->text, textbox->font);
+        text_width = layout->width;
         text_height = textbox->font[FONT_HEIGHT];
     }
     else
@@ -200,115 +427,104 @@ void widget_textbox(glcd_t *display, textbox_t *textbox)
         // TODO: others NONE options
     }
 
-    uint8_t i = 0, index;
-    const char *ptext = textbox->text;
+    uint8_t i, j;
     char buffer[DISPLAY_WIDTH/2];
 
-    text_width = 0;
-    text_height = 0;
-    index = FONT_FIXED_WIDTH;
-
-    while (*ptext)
+    // draws the lines
+    for (i = 0, text_height = 0; i < layout->lines_count; i++)
     {
-        // gets the index of the current character
-        if (!FONT_IS_MONO_SPACED(textbox->font)) index = FONT_WIDTH_TABLE + ((*ptext) - textbox->font[FONT_FIRST_CHAR]);
-
-        // calculates the text width
-        text_width += textbox->font[index] + FONT_INTERCHAR_SPACE;
-
-        // buffering
-        buffer[i++] = *ptext;
-
-        // checks the width limit
-        if (text_width >= textbox->width || *ptext == '\n')
-        {
-            if (*ptext == '\n') ptext++;
-
-            // check whether is single line
-            if (textbox->mode == TEXT_SINGLE_LINE) break;
-            else buffer[i-1] = 0;
-
-            glcd_text(display, textbox->x, textbox->y + text_height, buffer, textbox->font, textbox->color);
-            text_height += textbox->font[FONT_HEIGHT] + 1;
-            text_width = 0;
-            i = 0;
-
-            // checks the height limit
-            if (text_height > textbox->height) break;
-        }
-        else ptext++;
-    }
+        const char *ptext = &textbox->text[layout->lines[i].start];
 
-    // draws the line
-    if (text_width > 0)
-    {
-        buffer[i] = 0;
+        for (j = 0; j < layout->lines[i].length && j < (sizeof(buffer) - 1) && ptext[j]; j++)
+            buffer[j] = ptext[j];
 
-        // checks the text width again
-        text_width = get_text_width(buffer, textbox->font);
-        if (text_width > textbox->width) buffer[i-1] = 0;
+        buffer[j] = 0;
 
         glcd_text(display, textbox->x, textbox->y + text_height, buffer, textbox->font, textbox->color);
+        text_height += textbox->font[FONT_HEIGHT] + 1;
     }
+
+    text_layout_release(layout);
 }
 
 
 void widget_listbox(glcd_t *display, listbox_t *listbox)
 {
-    uint8_t i, font_height, max_lines, y_line;
-    uint8_t first_line, focus, center_focus, focus_height;
-    char aux[DISPLAY_WIDTH/2];
-    const char *line_txt;
+    uint8_t i, max_lines, first_line, focus, focus_height, y_line;
 
     glcd_rect_fill(display, listbox->x, listbox->y, listbox->width, listbox->height, ~listbox->color);
 
-    font_height = listbox->font[FONT_HEIGHT];
-    max_lines = listbox->height / (font_height + listbox->line_space);
-
-    center_focus = (max_lines / 2) - (1 - (max_lines % 2));
-    first_line = 0;
+    listbox_layout(listbox, &max_lines, &first_line);
+    focus = listbox->hover - first_line;
+    focus_height = listbox->font[FONT_HEIGHT] + listbox->line_top_margin + listbox->line_bottom_margin;
+    y_line = listbox->y + listbox->line_space;
 
-    if (listbox->hover > center_focus && listbox->count > max_lines)
+    for (i = 0; i < max_lines; i++)
     {
-        first_line = listbox->hover - center_focus;
-        if (first_line > ABS(listbox->count - max_lines))
+        listbox_draw_line(display, listbox, first_line + i, y_line);
+
+        if (i == focus)
         {
-            first_line = ABS(listbox->count - max_lines);
+            glcd_rect_invert(display, listbox->x, y_line - listbox->line_top_margin, listbox->width, focus_height);
         }
+
+        y_line += listbox->font[FONT_HEIGHT] + listbox->line_space;
     }
+}
 
-    if (max_lines > listbox->count) max_lines = listbox->count;
-    focus = listbox->hover - first_line;
-    focus_height = font_height + listbox->line_top_margin + listbox->line_bottom_margin;
-    y_line = listbox->y + listbox->line_space;
+void widget_listbox_view(glcd_t *display, listbox_t *listbox, listbox_view_t *view)
+{
+    uint8_t max_lines, first_line, pitch, focus_height, y_first, line;
+    int16_t shift;
 
-    for (i = 0; i < max_lines; i++)
+    listbox_layout(listbox, &max_lines, &first_line);
+    shift = (int16_t) first_line - view->first_line;
+
+    // anything other than a focus move or a single line scroll needs the full redraw
+    if (!view->valid || view->list != listbox->list || view->count != listbox->count ||
+        view->selected != listbox->selected || shift > 1 || shift < -1)
     {
-        if (i < listbox->count)
-        {
-            line_txt = listbox->list[first_line + i];
+        widget_listbox(display, listbox);
+    }
+    else if (shift != 0 || view->hover != listbox->hover)
+    {
+        pitch = listbox->font[FONT_HEIGHT] + listbox->line_space;
+        focus_height = listbox->font[FONT_HEIGHT] + listbox->line_top_margin + listbox->line_bottom_margin;
+        y_first = listbox->y + listbox->line_space - listbox->line_top_margin;
 
-            if ((first_line + i) == listbox->selected)
-            {
-                uint8_t j = 0;
-                aux[j++] = ' ';
-                aux[j++] = '>';
-                aux[j++] = ' ';
-                while (*line_txt && j < sizeof(aux)-1) aux[j++] = *line_txt++;
-                aux[j] = 0;
-                line_txt = aux;
-            }
+        // removes the old focus
+        line = view->hover - view->first_line;
+        glcd_rect_invert(display, listbox->x, y_first + (line * pitch), listbox->width, focus_height);
+
+        if (shift != 0)
+        {
+            // moves the visible lines and renders only the exposed one
+            glcd_vscroll(display, listbox->x, listbox->y, listbox->width, listbox->height,
+                         -shift * pitch, ~listbox->color);
 
-            glcd_text(display, listbox->x + listbox->text_left_margin, y_line, line_txt, listbox->font, listbox->color);
+            line = (shift > 0) ? (max_lines - 1) : 0;
+            glcd_rect_fill(display, listbox->x, listbox->y + (line * pitch), listbox->width, pitch, ~listbox->color);
+            listbox_draw_line(display, listbox, first_line + line, listbox->y + listbox->line_space + (line * pitch));
 
-            if (i == focus)
+            // the line pushed out at the bottom may be partially visible
+            if (listbox->height > (max_lines * pitch))
             {
-                glcd_rect_invert(display, listbox->x, y_line - listbox->line_top_margin, listbox->width, focus_height);
+                glcd_rect_fill(display, listbox->x, listbox->y + (max_lines * pitch), listbox->width,
+                               listbox->height - (max_lines * pitch), ~listbox->color);
             }
-
-            y_line += font_height + listbox->line_space;
         }
+
+        // draws the new focus
+        line = listbox->hover - first_line;
+        glcd_rect_invert(display, listbox->x, y_first + (line * pitch), listbox->width, focus_height);
     }
+
+    view->valid = 1;
+    view->list = listbox->list;
+    view->count = listbox->count;
+    view->selected = listbox->selected;
+    view->hover = listbox->hover;
+    view->first_line = first_line;
 }
 
 void widget_listbox2(glcd_t *display, listbox_t *listbox) //FIXME: function hardcoded
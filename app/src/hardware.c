@@ -21,8 +21,16 @@
 */
 
 // check in hardware_setup() what is the function of each timer
-#define TIMER0_PRIORITY     3
-#define TIMER1_PRIORITY     2
+// timer 0 modulates the LEDs, it preempts everything so the bits keep their weights
+#define TIMER0_PRIORITY     0
+// the actuators callback notifies the actuators task, so timer 1 must not be above configMAX_SYSCALL_INTERRUPT_PRIORITY
+#define TIMER1_PRIORITY     5
+// same as timer 1, both ISRs change the actuators state and can't preempt each other
+#define EINT3_PRIORITY      5
+
+// lowest priority channel, the ADC results are copied to a circular buffer
+#define ADC_DMA_CHANNEL     7
+#define ADC_SAMPLES_SIZE    (EXPRESSIONS_COUNT * EXPRESSION_OVERSAMPLING)
 
 /*
 ************************************************************************************************************************
@@ -51,6 +59,21 @@ static const led_pins_t LEDS_PINS[] = {
 #endif
 };
 
+static const uint8_t GLCD_BACKLIGHT_PWM[] = {
+#ifdef GLCD0_BACKLIGHT_PWM
+    GLCD0_BACKLIGHT_PWM,
+#endif
+#ifdef GLCD1_BACKLIGHT_PWM
+    GLCD1_BACKLIGHT_PWM,
+#endif
+#ifdef GLCD2_BACKLIGHT_PWM
+    GLCD2_BACKLIGHT_PWM,
+#endif
+#ifdef GLCD3_BACKLIGHT_PWM
+    GLCD3_BACKLIGHT_PWM
+#endif
+};
+
 static const uint8_t *ENCODER_PINS[] = {
 #ifdef ENCODER0_PINS
     (const uint8_t []) ENCODER0_PINS,
@@ -81,6 +104,17 @@ static const uint8_t *FOOTSWITCH_PINS[] = {
 #endif
 };
 
+#if EXPRESSIONS_COUNT > 0
+static const uint8_t *EXPRESSION_PINS[] = {
+#ifdef EXPRESSION0_PINS
+    (const uint8_t []) EXPRESSION0_PINS,
+#endif
+#ifdef EXPRESSION1_PINS
+    (const uint8_t []) EXPRESSION1_PINS
+#endif
+};
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -115,7 +149,12 @@ static led_t g_leds[LEDS_COUNT];
 static encoder_t g_encoders[ENCODERS_COUNT];
 static button_t g_footswitches[FOOTSWITCHES_COUNT];
 static uint32_t g_counter;
-static int g_brightness;
+#if EXPRESSIONS_COUNT > 0
+static expression_t g_expressions[EXPRESSIONS_COUNT];
+// written by the GPDMA, each word is the ADC global data register
+static volatile uint32_t g_adc_samples[ADC_SAMPLES_SIZE];
+static GPDMA_LLI_Type g_adc_lli;
+#endif
 
 
 /*
@@ -124,6 +163,10 @@ static int g_brightness;
 ************************************************************************************************************************
 */
 
+#if EXPRESSIONS_COUNT > 0
+static void expressions_sample(void);
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -138,6 +181,43 @@ static int g_brightness;
 ************************************************************************************************************************
 */
 
+#if EXPRESSIONS_COUNT > 0
+// averages the last conversions of each channel, the result is scaled to 16 bits
+static void expressions_sample(void)
+{
+    uint32_t sample, sum[EXPRESSIONS_COUNT], count[EXPRESSIONS_COUNT];
+    uint8_t i, j;
+
+    for (j = 0; j < EXPRESSIONS_COUNT; j++)
+    {
+        sum[j] = 0;
+        count[j] = 0;
+    }
+
+    for (i = 0; i < ADC_SAMPLES_SIZE; i++)
+    {
+        sample = g_adc_samples[i];
+        if (!(sample & ADC_GDR_DONE_FLAG)) continue;
+
+        for (j = 0; j < EXPRESSIONS_COUNT; j++)
+        {
+            if (ADC_GDR_CH(sample) == EXPRESSION_PINS[j][3])
+            {
+                sum[j] += ADC_GDR_RESULT(sample);
+                count[j]++;
+                break;
+            }
+        }
+    }
+
+    for (j = 0; j < EXPRESSIONS_COUNT; j++)
+    {
+        if (count[j] == 0) continue;
+        actuators_analog_sample(EXPRESSION_PINS[j][3], (sum[j] << 4) / count[j]);
+    }
+}
+#endif
+
 
 /*
 ************************************************************************************************************************
@@ -185,19 +265,133 @@ void hardware_setup(void)
         actuator_set_prop(hardware_actuators(ENCODER0 + i), BUTTON_HOLD_TIME, TOOL_MODE_TIME);
     }
 
+    ////////////////////////////////////////////////////////////////
+    // GPIO interrupts configuration
+    // the encoders channels are decoded on both edges, only ports 0 and 2 have interrupts
+
+    uint32_t edge_pins[2] = {0, 0};
+    for (i = 0; i < ENCODERS_COUNT; i++)
+    {
+        if (ENCODER_PINS[i][2] == 0) edge_pins[0] |= (1 << ENCODER_PINS[i][3]);
+        if (ENCODER_PINS[i][2] == 2) edge_pins[1] |= (1 << ENCODER_PINS[i][3]);
+        if (ENCODER_PINS[i][4] == 0) edge_pins[0] |= (1 << ENCODER_PINS[i][5]);
+        if (ENCODER_PINS[i][4] == 2) edge_pins[1] |= (1 << ENCODER_PINS[i][5]);
+    }
+
+    GPIO_IntCmd(0, edge_pins[0], 0);
+    GPIO_IntCmd(0, edge_pins[0], 1);
+    GPIO_IntCmd(2, edge_pins[1], 0);
+    GPIO_IntCmd(2, edge_pins[1], 1);
+    GPIO_ClearInt(0, edge_pins[0]);
+    GPIO_ClearInt(2, edge_pins[1]);
+    NVIC_SetPriority(EINT3_IRQn, EINT3_PRIORITY);
+    NVIC_EnableIRQ(EINT3_IRQn);
+
+    PINSEL_CFG_Type PinCfg;
+
+#if EXPRESSIONS_COUNT > 0
+    ////////////////////////////////////////////////////////////////
+    // ADC and GPDMA configuration
+    // the expression pedals are converted in burst mode and the GPDMA copies the results to a
+    // circular buffer, the timer 1 averages it so the CPU never waits for a conversion
+
+    ADC_Init(LPC_ADC, EXPRESSION_ADC_RATE);
+    // the channels request the DMA, the ADC interrupt itself stays disabled
+    ADC_IntConfig(LPC_ADC, ADC_ADGINTEN, DISABLE);
+
+    for (i = 0; i < EXPRESSIONS_COUNT; i++)
+    {
+        actuator_create(EXPRESSION_PEDAL, i, hardware_actuators(EXPRESSION0 + i));
+        actuator_set_pins(hardware_actuators(EXPRESSION0 + i), EXPRESSION_PINS[i]);
+
+        PinCfg.Portnum = EXPRESSION_PINS[i][0];
+        PinCfg.Pinnum = EXPRESSION_PINS[i][1];
+        PinCfg.Funcnum = EXPRESSION_PINS[i][2];
+        PinCfg.Pinmode = PINSEL_PINMODE_TRISTATE;
+        PinCfg.OpenDrain = PINSEL_PINMODE_NORMAL;
+        PINSEL_ConfigPin(&PinCfg);
+
+        ADC_ChannelCmd(LPC_ADC, EXPRESSION_PINS[i][3], ENABLE);
+        ADC_IntConfig(LPC_ADC, (ADC_TYPE_INT_OPT) EXPRESSION_PINS[i][3], ENABLE);
+    }
+
+    GPDMA_Channel_CFG_Type GPDMACfg;
+    GPDMA_Init();
+    // the linked list item points to itself, so the buffer is refilled forever
+    g_adc_lli.SrcAddr = (uint32_t) &LPC_ADC->ADGDR;
+    g_adc_lli.DstAddr = (uint32_t) g_adc_samples;
+    g_adc_lli.NextLLI = (uint32_t) &g_adc_lli;
+    g_adc_lli.Control = GPDMA_DMACCxControl_TransferSize(ADC_SAMPLES_SIZE) |
+                        GPDMA_DMACCxControl_SBSize(GPDMA_BSIZE_1) | GPDMA_DMACCxControl_DBSize(GPDMA_BSIZE_1) |
+                        GPDMA_DMACCxControl_SWidth(GPDMA_WIDTH_WORD) | GPDMA_DMACCxControl_DWidth(GPDMA_WIDTH_WORD) |
+                        GPDMA_DMACCxControl_DI;
+    GPDMACfg.ChannelNum = ADC_DMA_CHANNEL;
+    GPDMACfg.SrcMemAddr = 0;
+    GPDMACfg.DstMemAddr = (uint32_t) g_adc_samples;
+    GPDMACfg.TransferSize = ADC_SAMPLES_SIZE;
+    GPDMACfg.TransferWidth = 0;
+    GPDMACfg.TransferType = GPDMA_TRANSFERTYPE_P2M;
+    GPDMACfg.SrcConn = GPDMA_CONN_ADC;
+    GPDMACfg.DstConn = 0;
+    GPDMACfg.DMALLI = (uint32_t) &g_adc_lli;
+    GPDMA_Setup(&GPDMACfg);
+    GPDMA_ChannelCmd(ADC_DMA_CHANNEL, ENABLE);
+
+    ADC_BurstCmd(LPC_ADC, ENABLE);
+#endif
+
+    ////////////////////////////////////////////////////////////////
+    // PWM1 configuration
+    // this is used to GLCDs backlight
+
+    PWM_TIMERCFG_Type PWM_ConfigStruct;
+    PWM_MATCHCFG_Type PWM_MatchConfigStruct;
+    // initialize PWM1, prescale count time of 1us
+    PWM_ConfigStruct.PrescaleOption = PWM_TIMER_PRESCALE_USVAL;
+    PWM_ConfigStruct.PrescaleValue = 1;
+    PWM_Init(LPC_PWM1, PWM_MODE_TIMER, &PWM_ConfigStruct);
+    // MR0 defines the period and resets the counter
+    PWM_MatchUpdate(LPC_PWM1, 0, GLCD_BACKLIGHT_PWM_PERIOD, PWM_MATCH_UPDATE_NOW);
+    PWM_MatchConfigStruct.MatchChannel = 0;
+    PWM_MatchConfigStruct.IntOnMatch = DISABLE;
+    PWM_MatchConfigStruct.ResetOnMatch = ENABLE;
+    PWM_MatchConfigStruct.StopOnMatch = DISABLE;
+    PWM_ConfigMatch(LPC_PWM1, &PWM_MatchConfigStruct);
+
+    for (i = 0; i < GLCD_COUNT; i++)
+    {
+        // the backlight pin is switched from GPIO to PWM output
+        PinCfg.Portnum = g_glcd[i].backlight_port;
+        PinCfg.Pinnum = g_glcd[i].backlight_pin;
+        PinCfg.Funcnum = GLCD_BACKLIGHT_PWM_FUNC;
+        PinCfg.Pinmode = PINSEL_PINMODE_TRISTATE;
+        PinCfg.OpenDrain = PINSEL_PINMODE_NORMAL;
+        PINSEL_ConfigPin(&PinCfg);
+
+        PWM_ChannelConfig(LPC_PWM1, GLCD_BACKLIGHT_PWM[i], PWM_CHANNEL_SINGLE_EDGE);
+        PWM_MatchConfigStruct.MatchChannel = GLCD_BACKLIGHT_PWM[i];
+        PWM_MatchConfigStruct.ResetOnMatch = DISABLE;
+        PWM_ConfigMatch(LPC_PWM1, &PWM_MatchConfigStruct);
+        PWM_ChannelCmd(LPC_PWM1, GLCD_BACKLIGHT_PWM[i], ENABLE);
+    }
+
     // default glcd brightness
-    g_brightness = MAX_BRIGHTNESS;
+    hardware_glcd_brightness(MAX_BRIGHTNESS);
+
+    PWM_ResetCounter(LPC_PWM1);
+    PWM_CounterCmd(LPC_PWM1, ENABLE);
+    PWM_Cmd(LPC_PWM1, ENABLE);
 
     ////////////////////////////////////////////////////////////////
     // Timer 0 configuration
-    // this timer is used to LEDs PWM
+    // this timer is used to LEDs binary code modulation
 
     // timer structs declaration
     TIM_TIMERCFG_Type TIM_ConfigStruct;
     TIM_MATCHCFG_Type TIM_MatchConfigStruct ;
-    // initialize timer 0, prescale count time of 10us
+    // initialize timer 0, prescale count time of 1us
     TIM_ConfigStruct.PrescaleOption = TIM_PRESCALE_USVAL;
-    TIM_ConfigStruct.PrescaleValue = 5;
+    TIM_ConfigStruct.PrescaleValue = 1;
     // use channel 0, MR0
     TIM_MatchConfigStruct.MatchChannel = 0;
     // enable interrupt when MR0 matches the value in TC register
@@ -206,8 +400,8 @@ void hardware_setup(void)
     TIM_MatchConfigStruct.ResetOnMatch = TRUE;
     // stop on MR0 if MR0 matches it
     TIM_MatchConfigStruct.StopOnMatch = FALSE;
-    // set Match value, count value of 1 (1 * 10us = 10us --> 100 kHz)
-    TIM_MatchConfigStruct.MatchValue = 1;
+    // set Match value, it is updated on each interrupt with the duration of the next bit
+    TIM_MatchConfigStruct.MatchValue = LEDS_BCM_UNIT_us - 1;
     // set configuration for Tim_config and Tim_MatchConfig
     TIM_Init(LPC_TIM0, TIM_TIMER_MODE, &TIM_ConfigStruct);
     TIM_ConfigMatch(LPC_TIM0, &TIM_MatchConfigStruct);
@@ -245,6 +439,17 @@ void hardware_setup(void)
     // to start timer
     TIM_Cmd(LPC_TIM1, ENABLE);
 
+    ////////////////////////////////////////////////////////////////
+    // Timer 2 configuration
+    // this timer is free running, without match, and gives the microseconds timestamp
+
+    // initialize timer 2, prescale count time of 1us
+    TIM_ConfigStruct.PrescaleOption = TIM_PRESCALE_USVAL;
+    TIM_ConfigStruct.PrescaleValue = 1;
+    TIM_Init(LPC_TIM2, TIM_TIMER_MODE, &TIM_ConfigStruct);
+    // to start timer
+    TIM_Cmd(LPC_TIM2, ENABLE);
+
     ////////////////////////////////////////////////////////////////
     // Serial initialization
 
@@ -344,7 +549,16 @@ glcd_t *hardware_glcds(uint8_t glcd_id)
 
 void hardware_glcd_brightness(int level)
 {
-    g_brightness = level;
+    uint8_t i;
+    uint32_t duty;
+
+    // a match value out of the period keeps the output always high
+    if (level <= 0) duty = 0;
+    else if (level >= MAX_BRIGHTNESS) duty = GLCD_BACKLIGHT_PWM_PERIOD + 1;
+    else duty = (level * GLCD_BACKLIGHT_PWM_PERIOD) / MAX_BRIGHTNESS;
+
+    for (i = 0; i < GLCD_COUNT; i++)
+        PWM_MatchUpdate(LPC_PWM1, GLCD_BACKLIGHT_PWM[i], duty, PWM_MATCH_UPDATE_NEXT_RST);
 }
 
 led_t *hardware_leds(uint8_t led_id)
@@ -365,6 +579,13 @@ void *hardware_actuators(uint8_t actuator_id)
         return (&g_footswitches[actuator_id - FOOTSWITCH0]);
     }
 
+#if EXPRESSIONS_COUNT > 0
+    if ((int8_t)actuator_id >= EXPRESSION0 && actuator_id < (EXPRESSION0 + EXPRESSIONS_COUNT))
+    {
+        return (&g_expressions[actuator_id - EXPRESSION0]);
+    }
+#endif
+
     return NULL;
 }
 
@@ -373,6 +594,11 @@ uint32_t hardware_timestamp(void)
     return g_counter;
 }
 
+uint32_t hardware_timestamp_us(void)
+{
+    return LPC_TIM2->TC;
+}
+
 void hardware_coreboard_power(uint8_t state)
 {
     // coreboard sometimes requires 1s pulse to initialize
@@ -399,44 +625,33 @@ void hardware_coreboard_power(uint8_t state)
 
 void TIMER0_IRQHandler(void)
 {
-    static int count = 1, state;
-
     if (TIM_GetIntStatus(LPC_TIM0, TIM_MR0_INT) == SET)
     {
-        // LEDs PWM
-        leds_clock();
+        // LEDs binary code modulation, the timer is reloaded with the weight of the bit
+        TIM_UpdateMatchValue(LPC_TIM0, 0, (leds_modulation() * LEDS_BCM_UNIT_us) - 1);
+    }
 
-        if (g_brightness == 0)
-        {
-            count = 1;
-            state = 1;
-        }
-        else if (g_brightness == MAX_BRIGHTNESS)
-        {
-            count = 1;
-            state = 0;
-        }
+    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+}
 
-        if (--count == 0)
-        {
-            if (state)
-            {
-                count = MAX_BRIGHTNESS - g_brightness;
-                glcd_backlight(&g_glcd[0], 0);
-                glcd_backlight(&g_glcd[1], 0);
-            }
-            else
-            {
-                count = g_brightness;
-                glcd_backlight(&g_glcd[0], 1);
-                glcd_backlight(&g_glcd[1], 1);
-            }
+void EINT3_IRQHandler(void)
+{
+    uint32_t pins;
 
-            state ^= 1;
-        }
+    // GPIO interrupts of ports 0 and 2 share the external interrupt 3
+    pins = LPC_GPIOINT->IO0IntStatR | LPC_GPIOINT->IO0IntStatF;
+    if (pins)
+    {
+        GPIO_ClearInt(0, pins);
+        actuators_pins_changed(0, pins);
     }
 
-    TIM_ClearIntPending(LPC_TIM0, TIM_MR0_INT);
+    pins = LPC_GPIOINT->IO2IntStatR | LPC_GPIOINT->IO2IntStatF;
+    if (pins)
+    {
+        GPIO_ClearInt(2, pins);
+        actuators_pins_changed(2, pins);
+    }
 }
 
 void TIMER1_IRQHandler(void)
@@ -444,7 +659,12 @@ void TIMER1_IRQHandler(void)
     if (TIM_GetIntStatus(LPC_TIM1, TIM_MR1_INT) == SET)
     {
         actuators_clock();
+        leds_clock();
         g_counter++;
+
+#if EXPRESSIONS_COUNT > 0
+        if ((g_counter % EXPRESSION_SAMPLE_TIME) == 0) expressions_sample();
+#endif
     }
 
     TIM_ClearIntPending(LPC_TIM1, TIM_MR1_INT);
@@ -4,136 +4,48 @@
 
 const uint8_t mod_logo[] = {
     128,64,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xc0,0xc0,0xe0,0xe0,0xf0,0xf0,
-    0xf8,0xf8,0xf8,0x7c,0x7c,0x7c,0x3c,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,0x3e,
-    0x3e,0x3e,0x7c,0x7c,0x7c,0x78,0xf8,0xf8,0xf0,0xf0,0xe0,0xe0,0xc0,0xc0,0x80,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0xc0,0xe0,0xf0,0xf8,0xfc,0xfe,0x3f,0x1f,0x0f,0x0f,0x07,0x03,0x01,0x01,
-    0x00,0xc0,0xe0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,
-    0xf0,0xf0,0xf0,0xf0,0xf0,0xe0,0xc0,0x00,0x01,0x01,0x03,0x07,0x07,0x0f,0x1f,0x3f,
-    0x7e,0xfc,0xf8,0xf0,0xe0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xf0,
-    0xfc,0xff,0xff,0x7f,0x0f,0x03,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0xff,0xff,0xff,0xff,0xff,0x03,0x01,0x00,0x00,0x00,0x01,0x83,0xff,0xff,0xff,
-    0xff,0xff,0xff,0xcf,0xef,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x01,0x03,0x0f,0x3f,0xff,0xff,0xfe,0xf0,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xff,0xff,
-    0xff,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x80,0xc3,0xc7,0xcf,0xcf,0xcf,0xcf,0xce,0xce,0xce,0xce,0xcf,0xcf,0xcf,0xcf,0xcf,
-    0xcf,0xcf,0xcf,0xcf,0xcf,0xc7,0xc3,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,
-    0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,
-    0xff,0xff,0x07,0x01,0x01,0x01,0x01,0xf1,0xf9,0xf9,0xf9,0xf1,0x01,0x01,0x01,0x01,
-    0x01,0x01,0x01,0x01,0x01,0x03,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0x3f,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x0f,
-    0x3f,0xff,0xff,0xfe,0xf0,0xc0,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,
-    0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x3f,0x3f,0x3f,0x3f,0x1f,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x80,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x80,0xc0,0xf0,0xfc,0xff,0xff,0x7f,0x0f,0x03,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x03,0x07,0x0f,0x1f,0x3f,0x7e,0xfc,0xf8,0xf0,0xe0,0xe0,0xc0,0x80,0x81,
-    0x03,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x07,
-    0x07,0x07,0x07,0x07,0x07,0x07,0x07,0x03,0x83,0x80,0xc0,0xe0,0xe0,0xf0,0xf8,0xfc,
-    0x7e,0x3f,0x1f,0x0f,0x07,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x03,0x03,0x07,0x07,0x0f,0x0f,
-    0x1f,0x1f,0x3e,0x3e,0x3e,0x3c,0x3c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,0x7c,
-    0x7c,0x3c,0x3c,0x3e,0x3e,0x3e,0x1f,0x1f,0x0f,0x0f,0x0f,0x07,0x03,0x03,0x01,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00
+    0xa8,0x00,0x06,0x80,0xc0,0xc0,0xe0,0xe0,0xf0,0xf0,0x82,0xf8,0x82,0x7c,0x00,0x3c,
+    0x8a,0x3e,0x82,0x7c,0x09,0x78,0xf8,0xf8,0xf0,0xf0,0xe0,0xe0,0xc0,0xc0,0x80,0xbf,
+    0x00,0x92,0x00,0x10,0xc0,0xe0,0xf0,0xf8,0xfc,0xfe,0x3f,0x1f,0x0f,0x0f,0x07,0x03,
+    0x01,0x01,0x00,0xc0,0xe0,0x84,0xf0,0x82,0x00,0x89,0xf0,0x10,0xe0,0xc0,0x00,0x01,
+    0x01,0x03,0x07,0x07,0x0f,0x1f,0x3f,0x7e,0xfc,0xf8,0xf0,0xe0,0xc0,0xbf,0x00,0x87,
+    0x00,0x08,0x80,0xf0,0xfc,0xff,0xff,0x7f,0x0f,0x03,0x01,0x89,0x00,0x84,0xff,0x01,
+    0x03,0x01,0x82,0x00,0x01,0x01,0x83,0x85,0xff,0x03,0xcf,0xef,0xff,0xff,0x89,0x00,
+    0x08,0x01,0x03,0x0f,0x3f,0xff,0xff,0xfe,0xf0,0xc0,0xbf,0x00,0x82,0x00,0x00,0xf8,
+    0x83,0xff,0x00,0x03,0x8c,0x00,0x02,0x80,0xc3,0xc7,0x83,0xcf,0x83,0xce,0x89,0xcf,
+    0x02,0xc7,0xc3,0x80,0x8c,0x00,0x00,0x01,0x83,0xff,0x00,0xfc,0xbf,0x00,0x02,0x00,
+    0x00,0x3f,0x83,0xff,0x00,0xc0,0x8a,0x00,0x00,0xfc,0x82,0xff,0x00,0x07,0x83,0x01,
+    0x00,0xf1,0x82,0xf9,0x00,0xf1,0x88,0x01,0x00,0x03,0x82,0xff,0x00,0xfe,0x8a,0x00,
+    0x00,0x80,0x83,0xff,0x00,0x3f,0xbf,0x00,0x82,0x00,0x08,0x01,0x0f,0x3f,0xff,0xff,
+    0xfe,0xf0,0xc0,0x80,0x86,0x00,0x83,0xff,0x00,0x80,0x83,0x00,0x83,0x3f,0x00,0x1f,
+    0x88,0x00,0x00,0x80,0x83,0xff,0x86,0x00,0x08,0x80,0xc0,0xf0,0xfc,0xff,0xff,0x7f,
+    0x0f,0x03,0xbf,0x00,0x87,0x00,0x0e,0x03,0x07,0x0f,0x1f,0x3f,0x7e,0xfc,0xf8,0xf0,
+    0xe0,0xe0,0xc0,0x80,0x81,0x03,0x95,0x07,0x0e,0x03,0x83,0x80,0xc0,0xe0,0xe0,0xf0,
+    0xf8,0xfc,0x7e,0x3f,0x1f,0x0f,0x07,0x03,0xbf,0x00,0x92,0x00,0x08,0x01,0x03,0x03,
+    0x07,0x07,0x0f,0x0f,0x1f,0x1f,0x82,0x3e,0x01,0x3c,0x3c,0x89,0x7c,0x01,0x3c,0x3c,
+    0x82,0x3e,0x01,0x1f,0x1f,0x82,0x0f,0x03,0x07,0x03,0x03,0x01,0xb0,0x00
 };
 
 const uint8_t mod_duo[] = {
     128,64,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFE, 0xF8, 0xF0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xF0, 0xF8, 0xFE, 0x7F, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFE, 0xFF, 0x0F, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07,
-    0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0F, 0xFF, 0xFE, 0xFC, 0xF8, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01, 0x03, 0x0F, 0x1F, 0x7F, 0xFE, 0xFC, 0xF0, 0xE0, 0x80,
-    0x00, 0x00, 0x80, 0xE0, 0xF0, 0xFC, 0xFE, 0x7F, 0x1F, 0x0F, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-    0xFF, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F,
-    0x1F, 0x1F, 0x1F, 0x0F, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F,
-    0x1F, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x0F, 0x1F, 0x1E, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03,
-    0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x1F, 0x1F, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1E, 0x1F, 0x0F, 0x07, 0x03, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0xFC, 0xFC, 0x00, 0x00,
-    0x00, 0x00, 0xE0, 0xF0, 0xF8, 0xFC, 0x3C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C,
-    0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x3C, 0xFC, 0xF8, 0xF0, 0xE0, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-    0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x1F, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x1F, 0x00, 0x00,
-    0x00, 0x00, 0x1F, 0x3F, 0x7F, 0xFF, 0xF0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-    0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xF0, 0xFF, 0x7F, 0x3F, 0x1F, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    0xbf,0x00,0xbf,0x00,0x90,0x00,0x83,0xff,0x05,0x7f,0xfe,0xf8,0xf0,0xc0,0x80,0x8b,
+    0x00,0x05,0x80,0xc0,0xf0,0xf8,0xfe,0x7f,0x83,0xff,0x83,0x00,0x04,0xf8,0xfc,0xfe,
+    0xff,0x0f,0x90,0x07,0x04,0x0f,0xff,0xfe,0xfc,0xf8,0x83,0x00,0x83,0xff,0x91,0x07,
+    0x04,0x0f,0xff,0xfe,0xfc,0xf8,0xa1,0x00,0x83,0xff,0x17,0x00,0x01,0x03,0x0f,0x1f,
+    0x7f,0xfe,0xfc,0xf0,0xe0,0x80,0x00,0x00,0x80,0xe0,0xf0,0xfc,0xfe,0x7f,0x1f,0x0f,
+    0x03,0x00,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x92,0x00,0x83,0xff,0x83,0x00,0x83,
+    0xff,0x92,0x00,0x83,0xff,0xa1,0x00,0x83,0x1f,0x86,0x00,0x02,0x03,0x07,0x0f,0x83,
+    0x1f,0x02,0x0f,0x07,0x03,0x86,0x00,0x83,0x1f,0x83,0x00,0x04,0x03,0x07,0x0f,0x1f,
+    0x1e,0x90,0x1c,0x04,0x1e,0x1f,0x0f,0x07,0x03,0x83,0x00,0x83,0x1f,0x91,0x1c,0x04,
+    0x1e,0x1f,0x0f,0x07,0x03,0xa1,0x00,0x83,0xfc,0x92,0x1c,0x04,0x3c,0xfc,0xf8,0xf0,
+    0xe0,0x84,0x00,0x83,0xfc,0x93,0x00,0x83,0xfc,0x83,0x00,0x04,0xe0,0xf0,0xf8,0xfc,
+    0x3c,0x92,0x1c,0x04,0x3c,0xfc,0xf8,0xf0,0xe0,0xa1,0x00,0x83,0xff,0x93,0x00,0x83,
+    0xff,0x84,0x00,0x83,0xff,0x93,0x00,0x83,0xff,0x83,0x00,0x83,0xff,0x94,0x00,0x83,
+    0xff,0xa1,0x00,0x83,0xff,0x92,0xe0,0x04,0xf0,0xff,0x7f,0x3f,0x1f,0x84,0x00,0x04,
+    0x1f,0x3f,0x7f,0xff,0xf0,0x91,0xe0,0x04,0xf0,0xff,0x7f,0x3f,0x1f,0x83,0x00,0x04,
+    0x1f,0x3f,0x7f,0xff,0xf0,0x92,0xe0,0x04,0xf0,0xff,0x7f,0x3f,0x1f,0xbf,0x00,0xbf,
+    0x00,0x90,0x00
 };
+
+const uint16_t mod_logo_size = sizeof(mod_logo);
+const uint16_t mod_duo_size = sizeof(mod_duo);
@@ -25,6 +25,7 @@
 #include "cli.h"
 #include "comm.h"
 #include "images.h"
+#include "tap_tempo.h"
 
 
 /*
@@ -35,6 +36,13 @@
 
 #define MSG_QUEUE_DEPTH     5
 
+// display scheduler periods in ticks
+#define DISPLAY_FRAME_TICKS     (configTICK_RATE_HZ / DISPLAY_MAX_FPS)
+#define NAVEG_UPDATE_TICKS      (NAVEG_UPDATE_TIME / portTICK_RATE_MS)
+
+// retry period of the actuator events deferred while the webgui link is busy
+#define ACTUATORS_DEFER_TICKS   (5 / portTICK_RATE_MS)
+
 
 /*
 ************************************************************************************************************************
@@ -49,6 +57,25 @@
 ************************************************************************************************************************
 */
 
+// each event is resolved to a single handler looked up by (mode, action)
+enum {ACTION_CLICK, ACTION_HOLD, ACTION_TURN, ACTION_PRESS, ACTION_RELEASE, ACTION_EXPRESSION, ACTIONS_COUNT};
+enum {MODE_DISCARD, MODE_CONTROL, MODE_TOOL, MODES_COUNT};
+
+typedef void (*action_handler_t)(uint8_t id);
+
+// the timestamp is in microseconds
+typedef struct ACTUATOR_EVENT_T {
+    uint8_t actuator, id, action;
+    uint32_t timestamp;
+} actuator_event_t;
+
+// turns of an encoder merged while the actuators task is not running, the timestamp is in microseconds
+typedef struct ENCODER_TURNS_T {
+    int16_t detents, steps;
+    uint32_t timestamp;
+    uint8_t queued;
+} encoder_turns_t;
+
 
 /*
 ************************************************************************************************************************
@@ -60,8 +87,11 @@
 #define TASK_NAME(name)     ((const char * const) (name))
 #define ACTUATOR_TYPE(act)  (((button_t *)(act))->type)
 
-#define ACTUATORS_QUEUE_SIZE    10
-#define RESERVED_QUEUE_SPACES   3
+// must be a power of two
+#define ACTUATORS_QUEUE_SIZE    16
+#define ACTUATORS_QUEUE_MASK    (ACTUATORS_QUEUE_SIZE - 1)
+// slots left to the clicks, holds and footswitches, the turns and pedal changes don't take them
+#define ACTUATORS_QUEUE_RESERVED    4
 
 
 /*
@@ -70,7 +100,19 @@
 ************************************************************************************************************************
 */
 
-static volatile xQueueHandle g_actuators_queue;
+// the ISRs are the only producer and the actuators task is the only consumer
+static actuator_event_t g_events[ACTUATORS_QUEUE_SIZE];
+static volatile uint8_t g_events_head, g_events_tail;
+static volatile encoder_turns_t g_turns[ENCODERS_COUNT];
+// only the latest value of each expression pedal is delivered
+static volatile uint16_t g_expression_values[EXPRESSIONS_SLOTS];
+static volatile uint8_t g_expressions_queued, g_expressions_missed;
+static xTaskHandle g_actuators_task;
+// handlers row of each actuator, resolved when the restore status or the tools change
+static const action_handler_t *g_dispatch[TOTAL_ACTUATORS];
+static uint32_t g_dispatch_tools_serial;
+static uint8_t g_dispatch_logged, g_dispatch_valid;
+static xTaskHandle g_displays_task;
 static uint8_t g_msg_buffer[WEBGUI_COMM_RX_BUFF_SIZE];
 
 /*
@@ -81,6 +123,23 @@ static uint8_t g_msg_buffer[WEBGUI_COMM_RX_BUFF_SIZE];
 
 // local functions
 static void actuators_cb(void *actuator);
+static uint8_t events_push(uint8_t actuator, uint8_t id, uint8_t action, uint32_t timestamp, uint8_t reserved);
+static uint8_t events_pop(actuator_event_t *event);
+static void events_dispatch(uint8_t actuator, uint8_t id, uint8_t action, uint8_t logged);
+static uint8_t events_deferred(void);
+static int16_t encoder_turns_take(uint8_t id, int16_t *steps);
+static uint16_t expression_take(uint8_t id);
+static void dispatch_update(uint8_t logged);
+
+// actions handlers
+static void encoder_hold(uint8_t id);
+static void encoder_turn_control(uint8_t id);
+static void encoder_turn_tool(uint8_t id);
+static void encoder_turn_discard(uint8_t id);
+static void foot_press(uint8_t id);
+static void foot_release(uint8_t id);
+static void expression_change(uint8_t id);
+static void expression_discard(uint8_t id);
 
 // tasks
 static void procotol_task(void *pvParameters);
@@ -137,44 +196,113 @@ void serial_error(uint8_t uart_id, uint32_t error)
     UNUSED_PARAM(error);
 }
 
-// this callback is called from a ISR
-static void actuators_cb(void *actuator)
+// called from ISR only, returns zero if no more than reserved slots are free
+static uint8_t events_push(uint8_t actuator, uint8_t id, uint8_t action, uint32_t timestamp, uint8_t reserved)
 {
-    if (g_protocol_busy)
-    {
-        if (!naveg_dialog_status()) return;
-    }  
+    uint8_t head = g_events_head;
+    if (((g_events_tail - head - 1) & ACTUATORS_QUEUE_MASK) <= reserved) return 0;
 
-    static uint8_t i, info[ACTUATORS_QUEUE_SIZE][3];
+    actuator_event_t *event = &g_events[head];
+    event->actuator = actuator;
+    event->id = id;
+    event->action = action;
+    event->timestamp = timestamp;
 
-    // does a copy of actuator id and status
-    uint8_t *actuator_info;
-    actuator_info = info[i];
-    if (++i == ACTUATORS_QUEUE_SIZE) i = 0;
+    // publishes the event only after it is complete
+    g_events_head = (head + 1) & ACTUATORS_QUEUE_MASK;
 
-    // fills the actuator info vector
-    actuator_info[0] = ((button_t *)(actuator))->type;
-    actuator_info[1] = ((button_t *)(actuator))->id;
-    actuator_info[2] = actuator_get_status(actuator);
+    return 1;
+}
 
-    // queue actuator info
-    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
-    if (ACTUATOR_TYPE(actuator) == BUTTON)
+// called from the actuators task only
+static uint8_t events_pop(actuator_event_t *event)
+{
+    uint8_t tail = g_events_tail;
+    if (tail == g_events_head) return 0;
+
+    *event = g_events[tail];
+    g_events_tail = (tail + 1) & ACTUATORS_QUEUE_MASK;
+
+    return 1;
+}
+
+// events wait in the queue while other task holds the link, unless a dialog waits for them
+static uint8_t events_deferred(void)
+{
+    return (protocol_busy() && !naveg_dialog_status());
+}
+
+// this callback is called from the timer 1 and EINT3 ISRs, both below the kernel priority ceiling
+static void actuators_cb(void *actuator)
+{
+    uint8_t type = ACTUATOR_TYPE(actuator);
+    uint8_t id = ((button_t *)(actuator))->id;
+    uint8_t status = actuator_get_status(actuator);
+    uint32_t now = hardware_timestamp_us();
+    uint8_t queued = 0;
+
+    // turns are merged into the pending delta of the encoder, only the first one takes a queue slot
+    if (type == ROTARY_ENCODER && (status & (EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW)))
     {
-        xQueueSendToFrontFromISR(g_actuators_queue, &actuator_info, &xHigherPriorityTaskWoken);
+        volatile encoder_turns_t *turns = &g_turns[id];
+        uint8_t acceleration = ((encoder_t *)(actuator))->acceleration;
+
+        if (ENCODER_TURNED_CW(status))
+        {
+            turns->detents++;
+            turns->steps += acceleration;
+        }
+        else
+        {
+            turns->detents--;
+            turns->steps -= acceleration;
+        }
+        turns->timestamp = now;
+
+        if (!turns->queued)
+        {
+            // a turn refused by the queue is kept merged and handled when the queue is drained
+            turns->queued = events_push(ENCODER0 + id, id, ACTION_TURN, now, ACTUATORS_QUEUE_RESERVED);
+            queued |= turns->queued;
+        }
+
+        status &= ~(EV_ENCODER_TURNED | EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW);
     }
-    else
+    else if (type == EXPRESSION_PEDAL && EXPRESSION_CHANGED(status))
     {
-        if (uxQueueSpacesAvailable(g_actuators_queue) > RESERVED_QUEUE_SPACES)
+        g_expression_values[id] = ((expression_t *)(actuator))->value;
+
+        if (!(g_expressions_queued & (1 << id)))
         {
-            // queue actuator info
-            xQueueSendToBackFromISR(g_actuators_queue, &actuator_info, &xHigherPriorityTaskWoken);
+            if (events_push(EXPRESSION0 + id, id, ACTION_EXPRESSION, now, ACTUATORS_QUEUE_RESERVED))
+            {
+                g_expressions_queued |= (1 << id);
+                g_expressions_missed &= ~(1 << id);
+                queued = 1;
+            }
+            else g_expressions_missed |= (1 << id);
         }
-        else
-            return;
 
+        status &= ~EV_EXPRESSION_CHANGED;
+    }
+
+    // clicks and footswitches keep their own slots to preserve the order
+    if (type == ROTARY_ENCODER)
+    {
+        if (BUTTON_CLICKED(status)) queued |= events_push(ENCODER0 + id, id, ACTION_CLICK, now, 0);
+        if (BUTTON_HOLD(status)) queued |= events_push(ENCODER0 + id, id, ACTION_HOLD, now, 0);
+    }
+    else if (type == BUTTON && !BUTTON_HOLD(status))
+    {
+        // the press time is taken here, the event can wait in the queue before it is handled
+        if (BUTTON_PRESSED(status)) queued |= events_push(FOOTSWITCH0 + id, id, ACTION_PRESS, now, 0);
+        if (BUTTON_RELEASED(status)) queued |= events_push(FOOTSWITCH0 + id, id, ACTION_RELEASE, now, 0);
     }
 
+    if (!queued) return;
+
+    portBASE_TYPE xHigherPriorityTaskWoken = pdFALSE;
+    vTaskNotifyGiveFromISR(g_actuators_task, &xHigherPriorityTaskWoken);
     portEND_SWITCHING_ISR(xHigherPriorityTaskWoken);
 }
 
@@ -195,8 +323,7 @@ static void procotol_task(void *pvParameters)
     while (1)
     {
         uint32_t msg_size;
-        g_protocol_busy = false;
-        system_lock_comm_serial(g_protocol_busy);
+        protocol_unlock(LINK_OWNER_PARSER);
         // blocks until receive a new message
         ringbuff_t *rb = comm_webgui_read();
         msg_size = ringbuff_read_until(rb, g_msg_buffer, WEBGUI_COMM_RX_BUFF_SIZE, 0);
@@ -204,8 +331,7 @@ static void procotol_task(void *pvParameters)
         if (msg_size > 0)
         {
             //if parsing messages block the actuator messages. 
-            g_protocol_busy = true;
-            system_lock_comm_serial(g_protocol_busy);
+            protocol_lock(LINK_OWNER_PARSER);
             msg_t msg;
             msg.sender_id = 0;
             msg.data = (char *) g_msg_buffer;
@@ -219,109 +345,287 @@ static void displays_task(void *pvParameters)
 {
     UNUSED_PARAM(pvParameters);
 
-    uint8_t i = 0;
-    uint32_t count = 0;
+    uint8_t i, naveg_armed = 0;
+    portTickType now, last_refresh[GLCD_COUNT], naveg_deadline = 0;
+    portTickType timeout = DISPLAY_FRAME_TICKS;
+
+    for (i = 0; i < GLCD_COUNT; i++)
+        last_refresh[i] = xTaskGetTickCount() - DISPLAY_FRAME_TICKS;
 
     while (1)
     {
-        // update GLCD
-        glcd_update(hardware_glcds(i));
-        if (++i == GLCD_COUNT) i = 0;
+        // sleeps until an update is requested, the polling covers the displays
+        // drawn by tasks which don't notify (e.g. protocol callbacks)
+        ulTaskNotifyTake(pdTRUE, timeout);
+
+        now = xTaskGetTickCount();
+        timeout = DISPLAY_FRAME_TICKS;
+
+        // update GLCDs, requests faster than the frame rate are coalesced
+        for (i = 0; i < GLCD_COUNT; i++)
+        {
+            glcd_t *glcd = hardware_glcds(i);
+            if (!glcd_need_update(glcd)) continue;
+
+            portTickType elapsed = now - last_refresh[i];
+            if (elapsed < DISPLAY_FRAME_TICKS)
+            {
+                // wakes up again as soon as this display is allowed to refresh
+                if ((DISPLAY_FRAME_TICKS - elapsed) < timeout)
+                    timeout = DISPLAY_FRAME_TICKS - elapsed;
+
+                continue;
+            }
+
+            glcd_update(glcd);
+            last_refresh[i] = now;
+        }
+
+        // the async requests not answered in time are released
+        comm_webgui_expire();
 
         //check if nav mode needs update
         if (naveg_get_pb_list_update()){
             naveg_update_pb_list();
         }
 
-        // I know, this is embarrassing
+        // periodic update of the tools, the period starts when the tool requests it
         if (naveg_need_update())
         {
-            if (++count == 500000)
+            if (!naveg_armed)
+            {
+                naveg_armed = 1;
+                naveg_deadline = now + NAVEG_UPDATE_TICKS;
+            }
+            else if ((int32_t) (now - naveg_deadline) >= 0)
             {
                 naveg_update();
-                count = 0;
+                naveg_deadline += NAVEG_UPDATE_TICKS;
+                xTaskNotifyGive(g_displays_task);
             }
         }
         else
         {
-            count = 0;
+            naveg_armed = 0;
         }
+    }
+}
+
+// takes the merged turns of an encoder, the next turn queues a new event
+static int16_t encoder_turns_take(uint8_t id, int16_t *steps)
+{
+    int16_t detents;
+
+    taskENTER_CRITICAL();
+    detents = g_turns[id].detents;
+    *steps = g_turns[id].steps;
+    g_turns[id].detents = 0;
+    g_turns[id].steps = 0;
+    g_turns[id].queued = 0;
+    taskEXIT_CRITICAL();
+
+    return detents;
+}
 
-        taskYIELD();
+// replays the merged turns of an encoder as a single change, only the steps past UINT8_MAX need other calls
+static void encoder_turn_control(uint8_t id)
+{
+    int16_t steps;
+    int16_t detents = encoder_turns_take(id, &steps);
+
+    uint8_t cw = (detents > 0);
+    if (!cw)
+    {
+        detents = -detents;
+        steps = -steps;
     }
+
+    // each detent moves at least one step
+    if (steps < detents) steps = detents;
+
+    while (steps > 0)
+    {
+        uint8_t chunk = (steps > UINT8_MAX) ? UINT8_MAX : steps;
+
+        if (cw) naveg_inc_control(id, chunk);
+        else naveg_dec_control(id, chunk);
+
+        steps -= chunk;
+    }
+}
+
+// the tools move one item per detent
+static void encoder_turn_tool(uint8_t id)
+{
+    int16_t steps;
+    int16_t detents = encoder_turns_take(id, &steps);
+
+    for (; detents > 0; detents--) naveg_down(id);
+    for (; detents < 0; detents++) naveg_up(id);
+}
+
+static void encoder_turn_discard(uint8_t id)
+{
+    int16_t steps;
+    encoder_turns_take(id, &steps);
+}
+
+static void encoder_hold(uint8_t id)
+{
+    if (id == DISPLAY_TOOL_TUNER)
+    {
+        if (!naveg_is_tool_mode(DISPLAY_TOOL_SYSTEM)) naveg_toggle_tool(id, id);
+    }
+    else naveg_toggle_tool(id, id);
+}
+
+static void foot_press(uint8_t id)
+{
+    naveg_foot_change(id, 1);
+}
+
+static void foot_release(uint8_t id)
+{
+    naveg_foot_change(id, 0);
+}
+
+// takes the latest value of an expression pedal, the next change queues a new event
+static uint16_t expression_take(uint8_t id)
+{
+    uint16_t value;
+
+    taskENTER_CRITICAL();
+    value = g_expression_values[id];
+    g_expressions_queued &= ~(1 << id);
+    g_expressions_missed &= ~(1 << id);
+    taskEXIT_CRITICAL();
+
+    return value;
+}
+
+static void expression_change(uint8_t id)
+{
+    naveg_expression_change(id, expression_take(id));
+}
+
+static void expression_discard(uint8_t id)
+{
+    expression_take(id);
+}
+
+// the turns and the expression pedals always have a handler, their pending values must be taken
+static const action_handler_t ACTION_HANDLERS[MODES_COUNT][ACTIONS_COUNT] = {
+    [MODE_DISCARD] = {
+        [ACTION_TURN] = encoder_turn_discard,
+        [ACTION_EXPRESSION] = expression_discard,
+    },
+    [MODE_CONTROL] = {
+        [ACTION_CLICK] = naveg_next_control,
+        [ACTION_HOLD] = encoder_hold,
+        [ACTION_TURN] = encoder_turn_control,
+        [ACTION_PRESS] = foot_press,
+        [ACTION_RELEASE] = foot_release,
+        [ACTION_EXPRESSION] = expression_change,
+    },
+    [MODE_TOOL] = {
+        [ACTION_CLICK] = naveg_enter,
+        [ACTION_HOLD] = encoder_hold,
+        [ACTION_TURN] = encoder_turn_tool,
+        [ACTION_EXPRESSION] = expression_change,
+    },
+};
+
+// the handlers may change the tools, so the check is done for each event
+static void events_dispatch(uint8_t actuator, uint8_t id, uint8_t action, uint8_t logged)
+{
+    action_handler_t handler;
+
+    if (!g_dispatch_valid || logged != g_dispatch_logged || naveg_tools_serial() != g_dispatch_tools_serial)
+        dispatch_update(logged);
+
+    handler = g_dispatch[actuator][action];
+    if (handler) handler(id);
+}
+
+// resolves the handlers of each actuator for the current mode of its display
+static void dispatch_update(uint8_t logged)
+{
+    uint8_t i, mode;
+
+    for (i = 0; i < SLOTS_COUNT; i++)
+    {
+        if (!logged) mode = MODE_DISCARD;
+        else if (naveg_is_tool_mode(i)) mode = MODE_TOOL;
+        else mode = MODE_CONTROL;
+
+        g_dispatch[ENCODER0 + i] = ACTION_HANDLERS[mode];
+        g_dispatch[FOOTSWITCH0 + i] = ACTION_HANDLERS[mode];
+    }
+
+#if EXPRESSIONS_COUNT > 0
+    // the expression pedals have no display
+    for (i = 0; i < EXPRESSIONS_COUNT; i++)
+        g_dispatch[EXPRESSION0 + i] = ACTION_HANDLERS[logged ? MODE_CONTROL : MODE_DISCARD];
+#endif
+
+    g_dispatch_tools_serial = naveg_tools_serial();
+    g_dispatch_logged = logged;
+    g_dispatch_valid = 1;
 }
 
 static void actuators_task(void *pvParameters)
 {
     UNUSED_PARAM(pvParameters);
 
-    uint8_t type, id, status;
-    uint8_t *actuator_info;
+    actuator_event_t event;
+    uint8_t i, logged;
+    portTickType timeout = portMAX_DELAY;
 
     while (1)
     {
-
-        portBASE_TYPE xStatus;
-
-        // take the actuator from queue
-        xStatus = xQueueReceive(g_actuators_queue, &actuator_info, portMAX_DELAY);
+        // a single wake drains everything queued since the last one
+        ulTaskNotifyTake(pdTRUE, timeout);
 
         // check if must enter in the restore mode
-        if (cli_restore(RESTORE_STATUS) == NOT_LOGGED)
-            cli_restore(RESTORE_CHECK_BOOT);
+        logged = cli_restore(RESTORE_STATUS);
+        if (logged == NOT_LOGGED)
+            logged = cli_restore(RESTORE_CHECK_BOOT);
+        logged = (logged == LOGGED_ON_SYSTEM);
+
+        // the navigation state changed by the webgui responses is owned by this task
+        if (!events_deferred()) naveg_process_responses();
 
-        // checks if actuator has successfully taken
-        if (xStatus == pdPASS && cli_restore(RESTORE_STATUS) == LOGGED_ON_SYSTEM)
+        while (!events_deferred() && events_pop(&event))
         {
-            type = actuator_info[0];
-            id = actuator_info[1];
-            status = actuator_info[2];
+            // the tap tempo keeps the time of every press, the next tap follows the last one whatever handled it
+            if (event.action == ACTION_PRESS) tap_tempo_press(event.id, event.timestamp);
 
-            // encoders
-            if (type == ROTARY_ENCODER)
+            events_dispatch(event.actuator, event.id, event.action, logged);
+        }
+
+        // turns and pedal changes refused by a full queue come after the events queued before them
+        if (!events_deferred() && g_events_tail == g_events_head)
+        {
+            for (i = 0; i < ENCODERS_COUNT; i++)
             {
-                if (BUTTON_CLICKED(status))
-                {
-                    naveg_next_control(id);
-                    naveg_enter(id);
-                }
-                if (BUTTON_HOLD(status))
-                {   
-                    if (id == DISPLAY_TOOL_TUNER)
-                    {
-                        if (!naveg_is_tool_mode(DISPLAY_TOOL_SYSTEM)) naveg_toggle_tool(id, id);
-                    }
-                    else naveg_toggle_tool(id, id);
-                    
-                }
-                if (ENCODER_TURNED_CW(status))
-                {
-                    naveg_inc_control(id);
-                    naveg_down(id);
-                }
-                if (ENCODER_TURNED_ACW(status))
-                {
-                    naveg_dec_control(id);
-                    naveg_up(id);
-                }
+                if (!g_turns[i].queued && g_turns[i].detents)
+                    events_dispatch(ENCODER0 + i, i, ACTION_TURN, logged);
             }
 
-            // footswitches
-            else if (type == BUTTON)
+#if EXPRESSIONS_COUNT > 0
+            for (i = 0; i < EXPRESSIONS_COUNT; i++)
             {
-               if (BUTTON_PRESSED(status))
-                {
-                    naveg_foot_change(id, 1);
-                }
-                
-                if (BUTTON_RELEASED(status))
-                {
-                    naveg_foot_change(id, 0);
-                }
+                if (g_expressions_missed & (1 << i))
+                    events_dispatch(EXPRESSION0 + i, i, ACTION_EXPRESSION, logged);
             }
-
-            glcd_update(hardware_glcds(id));
+#endif
         }
+
+        // the deferred events are kept in order and retried until the link is released
+        timeout = (g_events_tail != g_events_head || naveg_responses_pending()) ? ACTUATORS_DEFER_TICKS : portMAX_DELAY;
+
+        // the display task does the refresh respecting the frame rate
+        xTaskNotifyGive(g_displays_task);
     }
 }
 
@@ -342,8 +646,8 @@ static void setup_task(void *pvParameters)
     UNUSED_PARAM(pvParameters);
 
     // draw start up images
-    screen_image(0, mod_logo);
-    screen_image(1, mod_duo);
+    screen_image(0, mod_logo, mod_logo_size);
+    screen_image(1, mod_duo, mod_duo_size);
 
     // CLI initialization
     cli_init();
@@ -351,14 +655,11 @@ static void setup_task(void *pvParameters)
     // initialize the communication resources
     comm_init();
 
-    // create the queues
-    g_actuators_queue = xQueueCreate(ACTUATORS_QUEUE_SIZE, sizeof(uint8_t *));
-
     // create the tasks
     xTaskCreate(procotol_task, TASK_NAME("proto"), 512, NULL, 4, NULL);
-    xTaskCreate(actuators_task, TASK_NAME("act"), 256, NULL, 3, NULL);
+    xTaskCreate(actuators_task, TASK_NAME("act"), 256, NULL, 3, &g_actuators_task);
     xTaskCreate(cli_task, TASK_NAME("cli"), 128, NULL, 2, NULL);
-    xTaskCreate(displays_task, TASK_NAME("disp"), 128, NULL, 1, NULL);
+    xTaskCreate(displays_task, TASK_NAME("disp"), 128, NULL, 1, &g_displays_task);
 
     // actuators callbacks
     uint8_t i;
@@ -369,6 +670,13 @@ static void setup_task(void *pvParameters)
         actuator_set_event(hardware_actuators(FOOTSWITCH0 + i), actuators_cb);
         actuator_enable_event(hardware_actuators(FOOTSWITCH0 + i), EV_ALL_BUTTON_EVENTS);
     }
+#if EXPRESSIONS_COUNT > 0
+    for (i = 0; i < EXPRESSIONS_COUNT; i++)
+    {
+        actuator_set_event(hardware_actuators(EXPRESSION0 + i), actuators_cb);
+        actuator_enable_event(hardware_actuators(EXPRESSION0 + i), EV_ALL_EXPRESSION_EVENTS);
+    }
+#endif
 
     // init the navigation
     naveg_init();
@@ -379,7 +687,16 @@ static void setup_task(void *pvParameters)
 
 void reset_queue(void)
 {
-    xQueueReset(g_actuators_queue);
+    taskENTER_CRITICAL();
+    g_events_tail = g_events_head;
+    memset((void *) g_turns, 0, sizeof(g_turns));
+    g_expressions_missed = 0;
+    taskEXIT_CRITICAL();
+}
+
+void actuators_wake(void)
+{
+    xTaskNotifyGive(g_actuators_task);
 }
 
 /*
@@ -17,6 +17,7 @@
 #include "semphr.h"
 #include "actuator.h"
 #include "protocol.h"
+#include "tap_tempo.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -26,6 +27,8 @@
 
 //reset actuator queue
 void reset_queue(void);
+//wakes the actuators task to handle the webgui responses
+void actuators_wake(void);
 
 /*
 ************************************************************************************************************************
@@ -37,7 +40,6 @@ enum {TT_INIT, TT_COUNTING};
 enum {TOOL_OFF, TOOL_ON};
 enum {BANKS_LIST, PEDALBOARD_LIST};
 
-#define MAX_CHARS_MENU_NAME     (128/4)
 #define MAX_TOOLS               5
 
 #define DIALOG_MAX_SEM_COUNT   1
@@ -46,6 +48,10 @@ enum {BANKS_LIST, PEDALBOARD_LIST};
 #define PAGE_DIR_UP			1
 #define PAGE_DIR_INIT		2
 
+#if NAVEG_CACHED_PAGES < 2
+#error "NAVEG_CACHED_PAGES must keep the page on screen and the next one"
+#endif
+
 /*
 ************************************************************************************************************************
 *           LOCAL CONSTANTS
@@ -62,6 +68,16 @@ static const menu_popup_t g_menu_popups[] = {
     {-1, NULL, NULL}
 };
 
+static const color_t g_led_list_colors[LED_LIST_AMOUNT_OF_COLORS] = {
+    LED_LIST_COLOR_1, LED_LIST_COLOR_2, LED_LIST_COLOR_3, LED_LIST_COLOR_4,
+    LED_LIST_COLOR_5, LED_LIST_COLOR_6, LED_LIST_COLOR_7
+};
+
+// items kept in front of the hover before turning the page (indexed by BANKS_LIST/PEDALBOARD_LIST),
+// the pedalboards pages have the "> back to banks" item
+static const uint8_t g_bp_margin_min[] = {2, 4};
+static const uint8_t g_bp_margin_max[] = {3, 3};
+
 
 /*
 ************************************************************************************************************************
@@ -70,7 +86,7 @@ static const menu_popup_t g_menu_popups[] = {
 */
 
 struct TAP_TEMPO_T {
-    uint32_t time, max;
+    uint32_t max;
     uint8_t state;
 } g_tap_tempo[SLOTS_COUNT];
 
@@ -78,6 +94,68 @@ struct TOOL_T {
     uint8_t state, display;
 } g_tool[MAX_TOOLS];
 
+// pages of a navigation list, the prefetched page is filled by the protocol task
+// what a control value looks like on the screen and leds
+typedef struct DRAWN_STATE_T {
+    int32_t step;
+    uint32_t time_ms;
+    uint8_t on;
+    char text[16];
+} drawn_state_t;
+
+typedef struct BP_CACHE_T {
+    bp_list_t *pages[NAVEG_CACHED_PAGES];
+    uint32_t used[NAVEG_CACHED_PAGES], clock;
+    uint8_t serial, prefetch_serial;
+    bp_list_t * volatile prefetched;
+    volatile uint8_t prefetching;
+} bp_cache_t;
+
+// scale points window of the paginated control of an encoder, the pages are received by the protocol task
+struct SCALE_WINDOW_T {
+    control_t * volatile page;
+    volatile uint8_t requesting;
+    uint8_t serial, request_serial, dir, first, last;
+} g_scale_windows[ENCODERS_COUNT];
+
+// controls addressed to an encoder by index, the slots own their controls
+// switches counts the indexes changed on the HMI which webgui didn't confirm yet
+struct CONTROL_RING_T {
+    control_t *slots[NAVEG_CONTROL_RING];
+    control_t *added;
+    uint8_t index, count, switches;
+} g_control_rings[ENCODERS_COUNT];
+
+// controls detached by pedalboard_clear, webgui restores them by the hash of the assignments instead of adding them again
+// the sets tagged with a pedalboard uid are kept by least recent use, the untagged one only until webgui adds controls
+struct UI_SNAPSHOT_T {
+    control_t *controls[TOTAL_ACTUATORS];
+    struct CONTROL_RING_T rings[ENCODERS_COUNT];
+    uint32_t hash, uid, size, used;
+    uint8_t valid;
+} g_ui_snapshots[NAVEG_UI_CACHE_SETS];
+
+// uid tagged to the current assignments, it's zero when webgui didn't tell which pedalboard they belong to
+struct UI_STATE_T {
+    uint32_t uid, serial;
+} g_ui_state;
+
+// pedalboard switched on the HMI before webgui loads it, the confirmed state is restored if the load fails
+// one load is sent at once, the switches made meanwhile are coalesced into the next one
+// the response is recorded by the protocol task and handled by the actuators task
+struct PB_LOAD_T {
+    uint8_t serial, sent_serial, next_serial, confirmed_serial, loading;
+    volatile uint8_t answered, failed;
+    uint16_t bank, pedalboard, sent_bank, sent_pedalboard, next_bank, next_pedalboard, next_bank_id;
+    char name[20], sent_name[20], next_name[20], next_uid[24];
+} g_pb_load;
+
+// footswitch pedalboards page received by the protocol task, installed by the actuators task
+struct FOOTSWITCH_PAGE_T {
+    bp_list_t * volatile received;
+    volatile uint8_t requesting;
+} g_footswitch_page;
+
 
 /*
 ************************************************************************************************************************
@@ -92,8 +170,9 @@ struct TOOL_T {
 ************************************************************************************************************************
 */
 
-static control_t *g_controls[ENCODERS_COUNT], *g_foots[FOOTSWITCHES_COUNT];
+static control_t *g_controls[ENCODERS_COUNT], *g_foots[FOOTSWITCHES_COUNT], *g_expressions[EXPRESSIONS_SLOTS];
 static bp_list_t *g_banks, *g_naveg_pedalboards, g_footswitch_pedalboards;
+static bp_cache_t g_bp_cache[2];
 static uint16_t g_bp_state, g_current_pedalboard, g_bp_first, g_pb_footswitches;
 static node_t *g_menu, *g_current_menu, *g_current_main_menu;
 static menu_item_t *g_current_item, *g_current_main_item;
@@ -107,9 +186,12 @@ static uint8_t dialog_active = 0;
 static int16_t g_current_bank;
 static uint8_t g_force_update_pedalboard = 1;
 static uint8_t g_scroll_dir = 1;
+// incremented on each tool state change
+static uint32_t g_tools_serial;
 
 // only enabled after "boot" command received
 bool g_should_wait_for_webgui = false;
+bool g_ui_communication_started = false;
 bool g_pedalboards_need_update = false;
 
 /*
@@ -120,9 +202,12 @@ bool g_pedalboards_need_update = false;
 
 static void display_control_add(control_t *control);
 static void display_control_rm(uint8_t hw_id);
+static void control_set(uint8_t id, control_t *control);
 
 static void foot_control_add(control_t *control);
 static void foot_control_rm(uint8_t hw_id);
+static void expression_control_add(control_t *control);
+static void expression_control_rm(uint8_t hw_id);
 
 static uint8_t bank_config_check(uint8_t foot);
 static void bank_config_update(uint8_t bank_func_idx);
@@ -146,11 +231,13 @@ static void tool_on(uint8_t tool, uint8_t display)
 {
     g_tool[tool].state = TOOL_ON;
     g_tool[tool].display = display;
+    g_tools_serial++;
 }
 
 static void tool_off(uint8_t tool)
 {
     g_tool[tool].state = TOOL_OFF;
+    g_tools_serial++;
 }
 
 static int tool_is_on(uint8_t tool)
@@ -175,17 +262,12 @@ static void display_disable_all_tools(uint8_t display)
 
     if (tool_is_on(DISPLAY_TOOL_TUNER))
     {
-        g_protocol_busy = true;
-        system_lock_comm_serial(g_protocol_busy);
-
-        // sends the data to GUI
-        comm_webgui_send(CMD_TUNER_OFF, strlen(CMD_TUNER_OFF));
+        protocol_lock(LINK_OWNER_NAVEG);
 
-        // waits the pedalboards list be received
-        comm_webgui_wait_response();
+        // sends the data to GUI and waits the response
+        comm_webgui_wait_response(comm_webgui_send(CMD_TUNER_OFF, strlen(CMD_TUNER_OFF)));
 
-        g_protocol_busy = false;
-        system_lock_comm_serial(g_protocol_busy);
+        protocol_unlock(LINK_OWNER_NAVEG);
     }
     
     for (i = 0; i < MAX_TOOLS; i++)
@@ -193,6 +275,8 @@ static void display_disable_all_tools(uint8_t display)
         if (g_tool[i].display == display)
             g_tool[i].state = TOOL_OFF;
     }
+
+    g_tools_serial++;
 }
 
 static int display_has_tool_enabled(uint8_t display)
@@ -254,10 +338,205 @@ static control_t *search_control(uint8_t hw_id, uint8_t *display)
 }
 
 // calculates the control value using the step
+// scaled integer value of the step on the control curve
+static int32_t control_fixed_value(control_t *control, int32_t step)
+{
+    int32_t value, offset = (int32_t) (((control->fixed_step * step) + 0x8000) >> 16);
+
+    if (step >= control->steps - 1)
+        value = control->fixed_maximum;
+    else if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+        value = fixed_exp2(fixed_log2(control->fixed_minimum) + offset);
+    else
+        value = control->fixed_minimum + offset;
+
+    if (value > control->fixed_maximum) value = control->fixed_maximum;
+    if (value < control->fixed_minimum) value = control->fixed_minimum;
+
+    return value;
+}
+
+// sets the scaled integer range of the linear, integer and logarithmic controls
+static void control_fixed_init(control_t *control)
+{
+    control->decimals = FIXED_NONE;
+
+    if (control->properties & (FLAG_CONTROL_REVERSE | FLAG_CONTROL_ENUMERATION | FLAG_CONTROL_SCALE_POINTS |
+                               FLAG_CONTROL_TRIGGER | FLAG_CONTROL_TOGGLED | FLAG_CONTROL_BYPASS)) return;
+
+    uint8_t decimals = fixed_decimals(control->minimum, control->maximum);
+    if (decimals == FIXED_NONE) return;
+
+    if (control->properties & FLAG_CONTROL_INTEGER) decimals = 0;
+
+    int32_t minimum = float_to_fixed(control->minimum, decimals);
+    int32_t maximum = float_to_fixed(control->maximum, decimals);
+
+    if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+    {
+        // the smallest scaled unit replaces zero
+        if (minimum < 0 || maximum < 0) return;
+        if (minimum == 0) minimum = 1;
+        if (maximum == 0) maximum = 1;
+    }
+    else if (control->properties & FLAG_CONTROL_INTEGER)
+    {
+        control->steps = (maximum - minimum) + 1;
+    }
+
+    if (maximum <= minimum || control->steps < 2) return;
+
+    // increment per step with 16 fraction bits, of the scaled value on linear controls (Q.16)
+    // and of its log2 on logarithmic ones (Q16.16 log2 shifted to Q32.32)
+    if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+        control->fixed_step = ((int64_t) (fixed_log2(maximum) - fixed_log2(minimum)) << 16) / (control->steps - 1);
+    else
+        control->fixed_step = ((int64_t) (maximum - minimum) << 16) / (control->steps - 1);
+
+    if (control->fixed_step <= 0) return;
+
+    control->fixed_minimum = minimum;
+    control->fixed_maximum = maximum;
+    control->decimals = decimals;
+
+    // the curve is computed once, the stepping only reads the table
+    if (control->steps > NAVEG_STEP_TABLE_MAX) return;
+
+    control->fixed_table = (int32_t *) MALLOC(sizeof(int32_t) * control->steps);
+    if (!control->fixed_table) return;
+
+    int32_t step;
+    for (step = 0; step < control->steps; step++)
+    {
+        control->fixed_table[step] = control_fixed_value(control, step);
+    }
+}
+
+// returns the step nearest to a scaled integer value within the limits
+static int32_t control_fixed_nearest(control_t *control, int32_t fixed_value)
+{
+    int64_t offset;
+    int32_t step;
+
+    // the table is monotonic, the nearest entry is found by bisection
+    if (control->fixed_table)
+    {
+        int32_t *table = control->fixed_table;
+        int32_t lo = 0, hi = control->steps - 1;
+
+        while (lo < hi)
+        {
+            step = (lo + hi) / 2;
+            if (table[step] < fixed_value) lo = step + 1;
+            else hi = step;
+        }
+
+        if (lo > 0 && (fixed_value - table[lo - 1]) < (table[lo] - fixed_value)) lo--;
+
+        return lo;
+    }
+
+    if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+        offset = (int64_t) (fixed_log2(fixed_value) - fixed_log2(control->fixed_minimum)) << 16;
+    else
+        offset = (int64_t) (fixed_value - control->fixed_minimum) << 16;
+
+    step = (offset + (control->fixed_step / 2)) / control->fixed_step;
+    if (step > control->steps - 1) step = control->steps - 1;
+
+    return step;
+}
+
+// updates the scaled integer value from control->value and returns the matching step
+static int32_t control_fixed_step(control_t *control)
+{
+    control->fixed_value = float_to_fixed(control->value, control->decimals);
+    if (control->fixed_value < control->fixed_minimum) control->fixed_value = control->fixed_minimum;
+    if (control->fixed_value > control->fixed_maximum) control->fixed_value = control->fixed_maximum;
+
+    return control_fixed_nearest(control, control->fixed_value);
+}
+
+// returns the step matching a value of a control without scaled integer stepping
+static int32_t control_value_step(control_t *control, float value)
+{
+    int32_t step;
+    uint8_t i;
+
+    if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+    {
+        step = (control->steps - 1) * log(value / control->minimum) / log(control->maximum / control->minimum) + 0.5;
+    }
+    else if (control->properties & (FLAG_CONTROL_REVERSE | FLAG_CONTROL_ENUMERATION | FLAG_CONTROL_SCALE_POINTS))
+    {
+        // the nearest scale point, a value sent as text may have lost some digits
+        step = 0;
+        for (i = 1; i < control->scale_points_count; i++)
+        {
+            if (fabsf(value - control->scale_points[i]->value) < fabsf(value - control->scale_points[step]->value))
+                step = i;
+        }
+    }
+    else if (control->properties & (FLAG_CONTROL_BYPASS | FLAG_CONTROL_TOGGLED))
+    {
+        step = value;
+    }
+    else
+    {
+        step = (value - control->minimum) / ((control->maximum - control->minimum) / control->steps);
+    }
+
+    if (step > control->steps - 1) step = control->steps - 1;
+    if (step < 0) step = 0;
+
+    return step;
+}
+
+// fills what the current value draws, the text is formatted as screen_encoder does
+static void control_drawn_state(control_t *control, drawn_state_t *state)
+{
+    memset(state, 0, sizeof(drawn_state_t));
+
+    if (control->decimals != FIXED_NONE)
+    {
+        uint8_t precision = ((control->value > 99.9f) || (control->properties & FLAG_CONTROL_INTEGER)) ? 0 : 2;
+        fixed_to_str(control->fixed_value, control->decimals, state->text, sizeof(state->text), precision);
+    }
+    else if ((control->value > 99.9) || (control->properties & FLAG_CONTROL_INTEGER))
+    {
+        int_to_str(control->value, state->text, sizeof(state->text), 0);
+    }
+    else
+    {
+        float_to_str(control->value, state->text, sizeof(state->text), 2);
+    }
+
+    state->step = control->step;
+
+    // the footswitch leds and footers only show if the value is set
+    state->on = (control->value > 0) | ((control->value != 0) << 1);
+
+    // the tap tempo led blinks at the value period
+    if (control->properties & FLAG_CONTROL_TAP_TEMPO)
+        state->time_ms = (uint32_t)(convert_to_ms(control->unit, control->value) + 0.5);
+}
+
 static void step_to_value(control_t *control)
 {
     // about the calculation: http://lv2plug.in/ns/ext/port-props/#rangeSteps
 
+    // scaled integer stepping, only the result is converted to float
+    if (control->decimals != FIXED_NONE)
+    {
+        if (control->fixed_table)
+            control->fixed_value = control->fixed_table[control->step];
+        else
+            control->fixed_value = control_fixed_value(control, control->step);
+
+        control->value = fixed_to_float(control->fixed_value, control->decimals);
+        return;
+    }
+
     float p_step = ((float) control->step) / ((float) (control->steps - 1));
     if (control->properties & FLAG_CONTROL_LOGARITHMIC)
     {
@@ -276,21 +555,127 @@ static void step_to_value(control_t *control)
     if (control->value < control->minimum) control->value = control->minimum;
 }
 
-// control assigned to display
-static void display_control_add(control_t *control)
+// frees the control unless it's shown or kept by the ring
+static void control_ring_release(uint8_t display, control_t *control)
 {
-    if (control->hw_id >= ENCODERS_COUNT) return;
+    struct CONTROL_RING_T *ring = &g_control_rings[display];
+    uint8_t i;
 
-    uint8_t display = control->hw_id;
+    if (!control || control == g_controls[display] || control == ring->added) return;
+
+    for (i = 0; i < NAVEG_CONTROL_RING; i++)
+    {
+        if (ring->slots[i] == control) return;
+    }
+
+    data_free_control(control);
+}
+
+// drops the controls kept by the ring, the shown one is kept
+static void control_ring_clear(uint8_t display)
+{
+    struct CONTROL_RING_T *ring = &g_control_rings[display];
+    control_t *control;
+    uint8_t i;
+
+    for (i = 0; i < NAVEG_CONTROL_RING; i++)
+    {
+        control = ring->slots[i];
+        ring->slots[i] = NULL;
+        control_ring_release(display, control);
+    }
+
+    control = ring->added;
+    ring->added = NULL;
+    control_ring_release(display, control);
+
+    ring->index = ring->count = ring->switches = 0;
+}
+
+// drops the controls farthest from the shown index until the ring fits its budget
+static void control_ring_trim(uint8_t display, control_t *keep)
+{
+    struct CONTROL_RING_T *ring = &g_control_rings[display];
+
+    while (1)
+    {
+        uint32_t size = 0;
+        uint8_t i, distance, farthest = NAVEG_CONTROL_RING, farthest_distance = 0;
+
+        for (i = 0; i < NAVEG_CONTROL_RING; i++)
+        {
+            control_t *control = ring->slots[i];
+            if (!control || control == g_controls[display]) continue;
+
+            size += data_control_size(control);
+            if (control == keep) continue;
+
+            // the indexes wrap around
+            distance = (i >= ring->index) ? (i - ring->index) : (ring->index - i);
+            if (ring->count > distance && (ring->count - distance) < distance) distance = ring->count - distance;
 
-    // checks if is already a control assigned in this display and remove it
-    if (g_controls[display])
-        data_free_control(g_controls[display]);
+            if (farthest == NAVEG_CONTROL_RING || distance > farthest_distance)
+            {
+                farthest = i;
+                farthest_distance = distance;
+            }
+        }
+
+        if (size <= NAVEG_CONTROL_RING_SIZE || farthest == NAVEG_CONTROL_RING) return;
+
+        // the switch to a dropped index requests the control again
+        control_t *control = ring->slots[farthest];
+        ring->slots[farthest] = NULL;
+        control_ring_release(display, control);
+    }
+}
+
+// a page received for the shown control replaces it on its slot too
+static void control_ring_replace(control_t *control)
+{
+    struct CONTROL_RING_T *ring = &g_control_rings[control->hw_id];
+    uint8_t i;
+
+    for (i = 0; i < NAVEG_CONTROL_RING; i++)
+    {
+        if (ring->slots[i] && ring->slots[i] == g_controls[control->hw_id]) ring->slots[i] = control;
+    }
+}
+
+// a page requested for the previous control is dropped
+static void scale_window_reset(uint8_t display, control_t *control)
+{
+    g_scale_windows[display].serial++;
+    g_scale_windows[display].first = 0;
+    g_scale_windows[display].last = (control->scale_points_flag & FLAG_SCALEPOINT_END_PAGE) ? 1 : 0;
+}
+
+// shows a control already parsed, its step is kept from the last time it was shown
+static void control_ring_show(uint8_t display, control_t *control)
+{
+    control_t *previous = g_controls[display];
 
-    // assign the new control
     g_controls[display] = control;
+    control_ring_release(display, previous);
 
-    if (control->properties & FLAG_CONTROL_LOGARITHMIC)
+    scale_window_reset(display, control);
+
+    if (display_has_tool_enabled(display)) return;
+
+    screen_encoder(display, control);
+    naveg_set_index(0, display, 0, 0);
+}
+
+// computes the step of a control received for the display
+static void display_control_init(control_t *control)
+{
+    control_fixed_init(control);
+
+    if (control->decimals != FIXED_NONE)
+    {
+        control->step = control_fixed_step(control);
+    }
+    else if (control->properties & FLAG_CONTROL_LOGARITHMIC)
     {
         if (control->minimum == 0.0)
             control->minimum = FLT_MIN;
@@ -301,29 +686,18 @@ static void display_control_add(control_t *control)
         if (control->value == 0.0)
             control->value = FLT_MIN;
 
-        control->step =
-            (control->steps - 1) * log(control->value / control->minimum) / log(control->maximum / control->minimum);
+        control->step = control_value_step(control, control->value);
     }
     else if (control->properties & (FLAG_CONTROL_REVERSE | FLAG_CONTROL_ENUMERATION | FLAG_CONTROL_SCALE_POINTS))
     {
-        control->step = 0;
-        uint8_t i;
         control->scroll_dir = g_scroll_dir;
-        for (i = 0; i < control->scale_points_count; i++)
-        {
-            if (control->value == control->scale_points[i]->value)
-            {
-                control->step = i;
-                break;
-            }
-        }
         control->steps = control->scale_points_count;
+        control->step = control_value_step(control, control->value);
     }
     else if (control->properties & FLAG_CONTROL_INTEGER)
     {
         control->steps = (control->maximum - control->minimum) + 1;
-        control->step =
-            (control->value - control->minimum) / ((control->maximum - control->minimum) / control->steps);
+        control->step = control_value_step(control, control->value);
     }
     else if (control->properties & (FLAG_CONTROL_BYPASS | FLAG_CONTROL_TOGGLED))
     {
@@ -332,9 +706,25 @@ static void display_control_add(control_t *control)
     }
     else
     {
-        control->step =
-            (control->value - control->minimum) / ((control->maximum - control->minimum) / control->steps);
+        control->step = control_value_step(control, control->value);
     }
+}
+
+// control assigned to display
+static void display_control_add(control_t *control)
+{
+    if (control->hw_id >= ENCODERS_COUNT) return;
+
+    uint8_t display = control->hw_id;
+
+    // assign the new control, the previous one is freed unless the ring keeps it
+    control_t *previous = g_controls[display];
+    g_controls[display] = control;
+    control_ring_release(display, previous);
+
+    scale_window_reset(display, control);
+
+    display_control_init(control);
 
     // if tool is enabled don't draws the control
     if (display_has_tool_enabled(display)) return;
@@ -359,10 +749,14 @@ static void display_control_rm(uint8_t hw_id)
 
     control_t *control = g_controls[display];
 
+    // the addressings of the encoder changed, the kept controls are stale
+    control_ring_clear(display);
+
     if (control)
     {
         data_free_control(control);
         g_controls[display] = NULL;
+        g_scale_windows[display].serial++;
         if (!display_has_tool_enabled(display))
             screen_encoder(display, NULL);
         return;
@@ -373,52 +767,22 @@ static void display_control_rm(uint8_t hw_id)
     }
 }
 
-static void set_alternated_led_list_colour(control_t *control)
+// blinks the tap tempo led in phase with the beats tapped on the footswitch
+static void tap_tempo_led(uint8_t foot, uint16_t time_ms)
 {
-    uint8_t color_id = control->scale_point_index % LED_LIST_AMOUNT_OF_COLORS;
-
-    switch (color_id)
-    {
-        case 0:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_1);
-        break;
-
-        case 1:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_2);
-        break;
-
-        case 2:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_3);
-        break;
-
-        case 3:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_4);
-        break;
+    uint32_t elapsed_ms = tap_tempo_phase(foot, time_ms * 1000) / 1000;
 
-        case 4:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_5);
-        break;
-
-        case 5:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_6);
-        break;
+    if (time_ms > TAP_TEMPO_TIME_ON)
+        led_blink_phase(hardware_leds(foot), TAP_TEMPO_TIME_ON, time_ms - TAP_TEMPO_TIME_ON, elapsed_ms);
+    else
+        led_blink_phase(hardware_leds(foot), time_ms / 2, time_ms / 2, elapsed_ms);
+}
 
-        case 6:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_7);
-        break;
+static void set_alternated_led_list_colour(control_t *control)
+{
+    uint8_t color_id = control->scale_point_index % LED_LIST_AMOUNT_OF_COLORS;
 
-        default:
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), BLACK);
-            led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), LED_LIST_COLOR_1);
-        break;
-    }
+    led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), g_led_list_colors[color_id]);
 }
 
 // control assigned to foot
@@ -440,6 +804,10 @@ static void foot_control_add(control_t *control)
         return;
     }
 
+    // a tap tempo assigned to the foot doesn't follow the taps of the previous control
+    if (!g_foots[control->hw_id - ENCODERS_COUNT] && (control->properties & FLAG_CONTROL_TAP_TEMPO))
+        tap_tempo_reset(control->hw_id - ENCODERS_COUNT);
+
     // stores the foot
     g_foots[control->hw_id - ENCODERS_COUNT] = control;
 
@@ -505,13 +873,10 @@ static void foot_control_add(control_t *control)
         uint16_t time_ms = (uint16_t)(convert_to_ms(control->unit, control->value) + 0.5);
 
         // setup the led blink
-        if (time_ms > TAP_TEMPO_TIME_ON)
-            led_blink(hardware_leds(control->hw_id - ENCODERS_COUNT), TAP_TEMPO_TIME_ON, time_ms - TAP_TEMPO_TIME_ON);
-        else
-            led_blink(hardware_leds(control->hw_id - ENCODERS_COUNT), time_ms / 2, time_ms / 2);
+        tap_tempo_led(control->hw_id - ENCODERS_COUNT, time_ms);
 
         // calculates the maximum tap tempo value
-        if (g_tap_tempo[control->hw_id].state == TT_INIT)
+        if (g_tap_tempo[control->hw_id - ENCODERS_COUNT].state == TT_INIT)
         {
             uint32_t max;
 
@@ -634,9 +999,11 @@ static void foot_control_rm(uint8_t hw_id)
         // checks if effect_instance and symbol match
         if (hw_id == g_foots[i]->hw_id)
         {
-            // remove the control
+            // remove the control, the next tap tempo starts with its own taps and maximum
             data_free_control(g_foots[i]);
             g_foots[i] = NULL;
+            tap_tempo_reset(i);
+            g_tap_tempo[i].state = TT_INIT;
 
             // check if foot isn't being used to bank function
             if (! bank_config_check(i))
@@ -655,141 +1022,618 @@ static void foot_control_rm(uint8_t hw_id)
     }
 }
 
-static void parse_control_page(void *data, menu_item_t *item)
+// control assigned to expression pedal, it has no screen
+static void expression_control_add(control_t *control)
 {
+    uint8_t expression = control->hw_id - EXPRESSION0;
 
-	(void) item;
-	char **list = data;
+    if (g_expressions[expression])
+        data_free_control(g_expressions[expression]);
 
-    control_t *control = data_parse_control(&list[1]);
+    g_expressions[expression] = control;
+}
 
-    naveg_add_control(control, 0);
+static void expression_control_rm(uint8_t hw_id)
+{
+    uint8_t expression = hw_id - EXPRESSION0;
 
-    //if encoder, redraw the index
-    if (control->hw_id < ENCODERS_COUNT)
+    if (g_expressions[expression])
     {
-    	//draw index, no need to update so no data
-    	naveg_set_index(0, control->hw_id, 0, 0);
+        data_free_control(g_expressions[expression]);
+        g_expressions[expression] = NULL;
     }
 }
 
-static void request_control_page(control_t *control, uint8_t dir)
+// FNV-1a
+static uint32_t ui_state_hash_data(uint32_t hash, const void *data, uint32_t size)
 {
-    // sets the response callback
-    comm_webgui_set_response_cb(parse_control_page, NULL);
+    const uint8_t *bytes = data;
 
-    char buffer[20];
-    memset(buffer, 0, sizeof buffer);
-    uint8_t i;
+    while (size--)
+    {
+        hash ^= *bytes++;
+        hash *= 16777619UL;
+    }
 
-    i = copy_command(buffer, CMD_CONTROL_PAGE); 
+    return hash;
+}
 
-    // insert the hw_id on buffer
-    i += int_to_str(control->hw_id, &buffer[i], sizeof(buffer) - i, 0);
+static uint32_t ui_state_hash_str(uint32_t hash, const char *str)
+{
+    if (str) hash = ui_state_hash_data(hash, str, strlen(str));
+    return ui_state_hash_data(hash, "", 1);
+}
 
-    // inserts one space
-    buffer[i++] = ' ';
+// only the assignment is hashed, the value and the window of paginated scale points change while the control is used
+static uint32_t ui_state_hash_control(uint32_t hash, uint8_t hw_id, const control_t *control)
+{
+    uint32_t i;
 
-    //bitmask for the page direction and wrap around
-	uint8_t bitmask = 0;
-	if (dir) bitmask |= FLAG_PAGINATION_PAGE_UP;
-	if ((control->hw_id >= ENCODERS_COUNT) && (control->scale_points_flag & FLAG_SCALEPOINT_WRAP_AROUND)) bitmask |= FLAG_PAGINATION_WRAP_AROUND;
+    hash = ui_state_hash_data(hash, &hw_id, sizeof(hw_id));
+    if (!control) return hash;
 
-    // insert the direction on buffer
-    i += int_to_str(bitmask, &buffer[i], sizeof(buffer) - i, 0);
+    hash = ui_state_hash_data(hash, &control->properties, sizeof(control->properties));
+    hash = ui_state_hash_data(hash, &control->minimum, sizeof(control->minimum));
+    hash = ui_state_hash_data(hash, &control->maximum, sizeof(control->maximum));
+    hash = ui_state_hash_data(hash, &control->steps, sizeof(control->steps));
+    hash = ui_state_hash_str(hash, control->label);
+    hash = ui_state_hash_str(hash, control->unit);
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    // an enumeration with other options is another control
+    hash = ui_state_hash_data(hash, &control->scale_points_count, sizeof(control->scale_points_count));
+    if (control->scale_points_flag & FLAG_SCALEPOINT_PAGINATED) return hash;
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    for (i = 0; control->scale_points && i < control->scale_points_count; i++)
+    {
+        if (!control->scale_points[i]) continue;
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+        hash = ui_state_hash_data(hash, &control->scale_points[i]->value, sizeof(control->scale_points[i]->value));
+        hash = ui_state_hash_str(hash, control->scale_points[i]->label);
+    }
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    return hash;
 }
 
-static void parse_banks_list(void *data, menu_item_t *item)
+static uint32_t ui_state_uid(const char *uid)
 {
-    (void) item;
-    char **list = data;
-    uint16_t count = strarr_length(&list[5]);
+    // the top bit tells a tagged set
+    return ui_state_hash_str(2166136261UL, uid) | 0x80000000;
+}
+
+static uint32_t ui_state_hash(void)
+{
+    uint32_t hash = 2166136261UL;
+    uint8_t i;
 
-    // workaround freeze when opening menu
-    delay_ms(20);
+    for (i = 0; i < ENCODERS_COUNT; i++)
+    {
+        hash = ui_state_hash_control(hash, i, g_controls[i]);
+        hash = ui_state_hash_data(hash, &g_control_rings[i].count, sizeof(g_control_rings[i].count));
+    }
 
-    // free the current banks list
-    if (g_banks) data_free_banks_list(g_banks);
+    for (i = 0; i < FOOTSWITCHES_COUNT; i++)
+        hash = ui_state_hash_control(hash, ENCODERS_COUNT + i, g_foots[i]);
 
-    // parses the list
-    g_banks = data_parse_banks_list(&list[5], count);
+#if EXPRESSIONS_COUNT > 0
+    for (i = 0; i < EXPRESSIONS_COUNT; i++)
+        hash = ui_state_hash_control(hash, EXPRESSION0 + i, g_expressions[i]);
+#endif
 
-    if (g_banks)
+    for (i = 0; i < BANK_FUNC_COUNT; i++)
     {
-    	g_banks->menu_max = (atoi(list[2]));
-        g_banks->page_min = (atoi(list[3]));
-        g_banks->page_max = (atoi(list[4]));
+        hash = ui_state_hash_data(hash, &g_bank_functions[i].hw_id, sizeof(g_bank_functions[i].hw_id));
+        hash = ui_state_hash_data(hash, &g_bank_functions[i].function, sizeof(g_bank_functions[i].function));
     }
 
-    naveg_set_banks(g_banks);
+    // kept positive so webgui can send it back as an integer argument
+    return hash & 0x7FFFFFFF;
 }
 
-//only toggled from the naveg toggle tool function
-static void request_banks_list(uint8_t dir)
+static void ui_snapshot_free(struct UI_SNAPSHOT_T *snapshot)
 {
-    g_bp_state = BANKS_LIST;
-
-    // sets the response callback
-    comm_webgui_set_response_cb(parse_banks_list, NULL);
+    uint8_t i, j;
 
-    char buffer[40];
-    memset(buffer, 0, 20);
+    for (i = 0; i < TOTAL_ACTUATORS; i++)
+    {
+        if (i < ENCODERS_COUNT)
+        {
+            for (j = 0; j < NAVEG_CONTROL_RING; j++)
+            {
+                if (snapshot->rings[i].slots[j] != snapshot->controls[i])
+                    data_free_control(snapshot->rings[i].slots[j]);
+            }
+        }
+
+        data_free_control(snapshot->controls[i]);
+    }
+
+    memset(snapshot, 0, sizeof(*snapshot));
+}
+
+// heap held by the controls of the set
+static uint32_t ui_snapshot_size(struct UI_SNAPSHOT_T *snapshot)
+{
+    uint32_t size = 0;
+    uint8_t i, j;
+
+    for (i = 0; i < TOTAL_ACTUATORS; i++)
+    {
+        if (i < ENCODERS_COUNT)
+        {
+            for (j = 0; j < NAVEG_CONTROL_RING; j++)
+            {
+                if (snapshot->rings[i].slots[j] != snapshot->controls[i])
+                    size += data_control_size(snapshot->rings[i].slots[j]);
+            }
+        }
+
+        size += data_control_size(snapshot->controls[i]);
+    }
+
+    return size;
+}
+
+// a set for the uid, the previous set of the same pedalboard or the least recently used one is dropped
+static struct UI_SNAPSHOT_T *ui_snapshot_slot(uint32_t uid)
+{
+    struct UI_SNAPSHOT_T *slot = NULL;
     uint8_t i;
 
-    i = copy_command(buffer, CMD_BANKS); 
+    for (i = 0; i < NAVEG_UI_CACHE_SETS; i++)
+    {
+        struct UI_SNAPSHOT_T *snapshot = &g_ui_snapshots[i];
 
-    // insert the direction on buffer
-    i += int_to_str(dir, &buffer[i], sizeof(buffer) - i, 0);
+        if (snapshot->valid && snapshot->uid == uid) ui_snapshot_free(snapshot);
+
+        if (!slot || !snapshot->valid || (slot->valid && snapshot->used < slot->used))
+            slot = snapshot;
+    }
+
+    if (slot->valid) ui_snapshot_free(slot);
+
+    return slot;
+}
+
+// drops the least recently used sets until the cache fits its budget, the one just stored is kept
+static void ui_snapshot_trim(struct UI_SNAPSHOT_T *keep)
+{
+    while (1)
+    {
+        struct UI_SNAPSHOT_T *oldest = NULL;
+        uint32_t size = 0;
+        uint8_t i;
+
+        for (i = 0; i < NAVEG_UI_CACHE_SETS; i++)
+        {
+            struct UI_SNAPSHOT_T *snapshot = &g_ui_snapshots[i];
+            if (!snapshot->valid) continue;
+
+            size += snapshot->size;
+            if (snapshot != keep && (!oldest || snapshot->used < oldest->used)) oldest = snapshot;
+        }
+
+        if (size <= NAVEG_UI_CACHE_SIZE || !oldest) return;
+
+        ui_snapshot_free(oldest);
+    }
+}
+
+// a set of the pedalboard with the hash, any pedalboard if the uid is zero
+static struct UI_SNAPSHOT_T *ui_snapshot_find(uint32_t uid, uint32_t hash)
+{
+    struct UI_SNAPSHOT_T *found = NULL;
+    uint8_t i;
+
+    for (i = 0; i < NAVEG_UI_CACHE_SETS; i++)
+    {
+        struct UI_SNAPSHOT_T *snapshot = &g_ui_snapshots[i];
+        if (!snapshot->valid) continue;
+
+        if (uid && snapshot->uid == uid)
+        {
+            // the addressings of the pedalboard changed since it was cached
+            if (snapshot->hash != hash)
+            {
+                ui_snapshot_free(snapshot);
+                return NULL;
+            }
+
+            return snapshot;
+        }
+
+        if (!uid && snapshot->hash == hash && (!found || snapshot->used > found->used))
+            found = snapshot;
+    }
+
+    return found;
+}
+
+static void parse_control_page(void *data, menu_item_t *item)
+{
+
+	(void) item;
+	char **list = data;
+
+    control_t *control = data_parse_control(&list[1]);
+
+    naveg_add_control(control, 0);
+
+    //if encoder, redraw the index
+    if (control->hw_id < ENCODERS_COUNT)
+    {
+    	//draw index, no need to update so no data
+    	naveg_set_index(0, control->hw_id, 0, 0);
+    }
+}
+
+// the request item is the window that requested the page
+static void prefetch_control_page(void *data, menu_item_t *item)
+{
+    struct SCALE_WINDOW_T *window = (struct SCALE_WINDOW_T *) item;
+    uint8_t display = window - g_scale_windows;
+    char **list = data;
+
+    // no data when the response didn't arrive
+    control_t *page = list ? data_parse_control(&list[1]) : NULL;
+
+    if (page && page->hw_id == display && page->scale_points_count > 0)
+    {
+        window->page = page;
+        page = NULL;
+    }
+
+    window->requesting = 0;
+
+    data_free_control(page);
+}
+
+static void request_control_page(control_t *control, uint8_t dir, uint8_t async)
+{
+    char buffer[20];
+    memset(buffer, 0, sizeof buffer);
+    uint8_t i;
+
+    i = copy_command(buffer, CMD_CONTROL_PAGE); 
+
+    // insert the hw_id on buffer
+    i += int_to_str(control->hw_id, &buffer[i], sizeof(buffer) - i, 0);
 
     // inserts one space
     buffer[i++] = ' ';
 
-    //insert current bank, because first time we are entering the menu
-    i += int_to_str(g_current_bank, &buffer[i], sizeof(buffer) - i, 0);
+    //bitmask for the page direction and wrap around
+	uint8_t bitmask = 0;
+	if (dir) bitmask |= FLAG_PAGINATION_PAGE_UP;
+	if ((control->hw_id >= ENCODERS_COUNT) && (control->scale_points_flag & FLAG_SCALEPOINT_WRAP_AROUND)) bitmask |= FLAG_PAGINATION_WRAP_AROUND;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    // insert the direction on buffer
+    i += int_to_str(bitmask, &buffer[i], sizeof(buffer) - i, 0);
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    if (async)
+    {
+        struct SCALE_WINDOW_T *window = &g_scale_windows[control->hw_id];
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+        window->requesting = 1;
+        window->request_serial = window->serial;
+        window->dir = dir;
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+        // the page is merged on the window by the next turn
+        comm_webgui_request(buffer, i, prefetch_control_page, (menu_item_t *) window, WEBGUI_ASYNC_TIMEOUT);
+        return;
+    }
 
-    g_banks->hover = g_current_bank;
-    g_banks->selected = g_current_bank;
+    protocol_lock(LINK_OWNER_NAVEG);
+
+    // sends the data to GUI and waits the page, it replaces the control
+    comm_webgui_wait_response(comm_webgui_request(buffer, i, parse_control_page, NULL, 0));
+
+    protocol_unlock(LINK_OWNER_NAVEG);
+}
+
+static void scale_point_free(scale_point_t *point)
+{
+    if (!point) return;
+
+    FREE(point->label);
+    FREE(point);
+}
+
+// merges the page on the window aligning their common scale points, the window is trimmed around the step
+static void scale_window_merge(control_t *control, control_t *page, struct SCALE_WINDOW_T *window)
+{
+    int16_t offset, n = control->scale_points_count, m = page->scale_points_count;
+    int16_t i, j, start, end, lo, hi, cursor;
+
+    // position of the first page scale point on the window
+    for (offset = 0; offset < n; offset++)
+    {
+        if (control->scale_points[offset]->value == page->scale_points[0]->value) break;
+    }
+
+    if (offset == n)
+    {
+        for (j = 1; j < m; j++)
+        {
+            if (page->scale_points[j]->value == control->scale_points[0]->value) break;
+        }
+
+        // a page without common scale points can't be placed
+        if (j == m) return;
+
+        offset = -j;
+    }
+
+    // a page which adds nothing in the requested direction means the window reached the list limit
+    if (window->dir == 0 && offset >= 0) window->first = 1;
+    if (window->dir == 1 && offset + m <= n) window->last = 1;
+    if (page->scale_points_flag & FLAG_SCALEPOINT_END_PAGE) window->last = 1;
+
+    start = (offset < 0) ? offset : 0;
+    end = (offset + m > n) ? (offset + m) : n;
+    cursor = control->step - start;
+
+    lo = 0;
+    hi = end - start;
+    if (hi > NAVEG_SCALE_POINTS_WINDOW)
+    {
+        lo = cursor - (NAVEG_SCALE_POINTS_WINDOW / 2);
+        if (lo < 0) lo = 0;
+        if (lo > hi - NAVEG_SCALE_POINTS_WINDOW) lo = hi - NAVEG_SCALE_POINTS_WINDOW;
+        hi = lo + NAVEG_SCALE_POINTS_WINDOW;
+    }
+
+    scale_point_t **points = (scale_point_t **) MALLOC(sizeof(scale_point_t *) * (hi - lo));
+    if (!points) return;
+
+    // the window keeps its own scale points, the page only fills the new positions
+    for (i = lo; i < hi; i++)
+    {
+        j = i + start;
+
+        if (j >= 0 && j < n)
+        {
+            points[i - lo] = control->scale_points[j];
+            control->scale_points[j] = NULL;
+        }
+        else
+        {
+            points[i - lo] = page->scale_points[j - offset];
+            page->scale_points[j - offset] = NULL;
+        }
+    }
+
+    // frees what was trimmed
+    for (j = 0; j < n; j++) scale_point_free(control->scale_points[j]);
+    FREE(control->scale_points);
+
+    if (lo > 0) window->first = 0;
+    if (hi < end - start) window->last = 0;
+
+    control->scale_points = points;
+    control->scale_points_count = hi - lo;
+    control->steps = control->scale_points_count;
+    control->step = cursor - lo;
+}
+
+// merges a page received since the last turn, called from the actuators task only
+static void scale_window_collect(uint8_t display)
+{
+    struct SCALE_WINDOW_T *window = &g_scale_windows[display];
+    control_t *control = g_controls[display];
+
+    if (window->requesting || !window->page) return;
+
+    control_t *page = window->page;
+    window->page = NULL;
+
+    if (control && control->scale_points_count > 0 && window->request_serial == window->serial)
+    {
+        float value = control->value;
+
+        scale_window_merge(control, page, window);
+
+        if (!display_has_tool_enabled(display))
+            screen_encoder(display, control);
+
+        // webgui answers the page with its own value, the value on the HMI is the one kept
+        if (page->value != value) control_set(display, control);
+    }
+
+    data_free_control(page);
+}
+
+// requests the next page before the step reaches the window edge
+static void scale_window_prefetch(uint8_t display, uint8_t dir)
+{
+    struct SCALE_WINDOW_T *window = &g_scale_windows[display];
+    control_t *control = g_controls[display];
+
+    // comm expiry calls back the request that isn't answered
+    if (window->requesting) return;
+
+    if (dir)
+    {
+        if (window->last || control->step + NAVEG_SCALE_POINTS_PREFETCH < control->steps - 1) return;
+    }
+    else
+    {
+        if (window->first || control->step > NAVEG_SCALE_POINTS_PREFETCH) return;
+    }
+
+    request_control_page(control, dir, 1);
+}
+
+static bp_list_t **bp_current(uint8_t list)
+{
+    return (list == BANKS_LIST) ? &g_banks : &g_naveg_pedalboards;
+}
+
+static void bp_free(uint8_t list, bp_list_t *page)
+{
+    if (list == BANKS_LIST) data_free_banks_list(page);
+    else data_free_pedalboards_list(page);
+}
+
+static bp_list_t *bp_parse(uint8_t list, char **data)
+{
+    bp_list_t *page;
+
+    // a short or mismatched response doesn't carry the page header
+    if (strarr_length(data) < 5) return NULL;
+
+    uint32_t count = strarr_length(&data[5]);
+
+    if (list == BANKS_LIST) page = data_parse_banks_list(&data[5], count);
+    else page = data_parse_pedalboards_list(&data[5], count);
+
+    if (page)
+    {
+        page->menu_max = atoi(data[2]);
+        page->page_min = atoi(data[3]);
+        page->page_max = atoi(data[4]);
+    }
+
+    return page;
+}
+
+// stores the page on the least recently used slot, the page on screen is never evicted
+static void bp_cache_store(uint8_t list, bp_list_t *page)
+{
+    bp_cache_t *cache = &g_bp_cache[list];
+    bp_list_t *current = *bp_current(list);
+    uint8_t i, slot = NAVEG_CACHED_PAGES;
+
+    for (i = 0; i < NAVEG_CACHED_PAGES; i++)
+    {
+        if (!cache->pages[i])
+        {
+            slot = i;
+            break;
+        }
+
+        if (cache->pages[i] == current) continue;
+
+        if (slot == NAVEG_CACHED_PAGES || cache->used[i] < cache->used[slot])
+            slot = i;
+    }
+
+    if (cache->pages[slot]) bp_free(list, cache->pages[slot]);
+
+    cache->pages[slot] = page;
+    cache->used[slot] = ++cache->clock;
 }
 
-//requested from the bp_up / bp_down functions when we reach the end of a page
-static void request_next_bank_page(uint8_t dir)
+// frees all pages but the one to keep, a prefetch in flight is discarded when it arrives
+static void bp_cache_clear(uint8_t list, bp_list_t *keep)
 {
-	//we need to save our current hover and selected here, the parsing function will discard those
-	uint8_t prev_hover = g_banks->hover;
-	uint8_t prev_selected = g_banks->selected;
+    bp_cache_t *cache = &g_bp_cache[list];
+    uint8_t i;
 
-	//request the banks as usual
-	g_bp_state = BANKS_LIST;
+    for (i = 0; i < NAVEG_CACHED_PAGES; i++)
+    {
+        if (!cache->pages[i] || cache->pages[i] == keep) continue;
 
-    // sets the response callback
-    comm_webgui_set_response_cb(parse_banks_list, NULL);
+        bp_free(list, cache->pages[i]);
+        cache->pages[i] = NULL;
+    }
+
+    cache->serial++;
+
+    if (!cache->prefetching && cache->prefetched)
+    {
+        bp_free(list, cache->prefetched);
+        cache->prefetched = NULL;
+    }
+}
+
+// moves the page received by the protocol task to the cache
+static void bp_cache_collect(uint8_t list)
+{
+    bp_cache_t *cache = &g_bp_cache[list];
+
+    if (cache->prefetching || !cache->prefetched) return;
+
+    bp_list_t *page = cache->prefetched;
+    cache->prefetched = NULL;
+
+    if (cache->prefetch_serial == cache->serial) bp_cache_store(list, page);
+    else bp_free(list, page);
+}
+
+// checks if the page still has items in front of the hover in the scroll direction
+static uint8_t bp_page_has(uint8_t list, const bp_list_t *page, uint16_t hover, uint8_t dir)
+{
+    if (dir == PAGE_DIR_UP)
+    {
+        return (hover >= page->page_min &&
+                (page->page_max == page->menu_max || hover + g_bp_margin_max[list] < page->page_max));
+    }
+
+    return (hover < page->page_max &&
+            (page->page_min == 0 || hover > page->page_min + g_bp_margin_min[list]));
+}
+
+static bp_list_t *bp_cache_find(uint8_t list, uint16_t hover, uint8_t dir)
+{
+    bp_cache_t *cache = &g_bp_cache[list];
+    uint8_t i;
+
+    bp_cache_collect(list);
+
+    for (i = 0; i < NAVEG_CACHED_PAGES; i++)
+    {
+        if (cache->pages[i] && bp_page_has(list, cache->pages[i], hover, dir))
+        {
+            cache->used[i] = ++cache->clock;
+            return cache->pages[i];
+        }
+    }
+
+    return NULL;
+}
+
+static void parse_banks_list(void *data, menu_item_t *item)
+{
+    (void) item;
+    bp_list_t *page = bp_parse(BANKS_LIST, data);
+
+    if (!page) return;
+
+    bp_cache_store(BANKS_LIST, page);
+    naveg_set_banks(page);
+}
+
+static void prefetch_page(uint8_t list, char **data)
+{
+    bp_cache_t *cache = &g_bp_cache[list];
+
+    // a page which wasn't collected is replaced, the actuators task doesn't touch it while prefetching
+    if (cache->prefetched)
+    {
+        bp_free(list, cache->prefetched);
+        cache->prefetched = NULL;
+    }
+
+    // no data when the response didn't arrive
+    cache->prefetched = data ? bp_parse(list, data) : NULL;
+    cache->prefetching = 0;
+}
+
+static void prefetch_banks_page(void *data, menu_item_t *item)
+{
+    (void) item;
+    prefetch_page(BANKS_LIST, data);
+}
+
+//only toggled from the naveg toggle tool function, returns zero if the list wasn't received
+static uint8_t request_banks_list(uint8_t dir)
+{
+    uint8_t received;
+
+    g_bp_state = BANKS_LIST;
 
     char buffer[40];
-    memset(buffer, 0, sizeof buffer);
+    memset(buffer, 0, 20);
     uint8_t i;
 
     i = copy_command(buffer, CMD_BANKS); 
@@ -800,60 +1644,54 @@ static void request_next_bank_page(uint8_t dir)
     // inserts one space
     buffer[i++] = ' ';
 
-    i += int_to_str(g_banks->hover, &buffer[i], sizeof(buffer) - i, 0);
+    //insert current bank, because first time we are entering the menu
+    i += int_to_str(g_current_bank, &buffer[i], sizeof(buffer) - i, 0);
+
+    protocol_lock(LINK_OWNER_NAVEG);
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    // sends the data to GUI and waits the banks list be received
+    received = comm_webgui_wait_response(comm_webgui_request(buffer, i, parse_banks_list, NULL, 0));
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    protocol_unlock(LINK_OWNER_NAVEG);
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+    // the navigation state was reset by a gui connection change
+    if (!received || !g_banks) return 0;
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    // the banks may have changed since the menu was left
+    bp_cache_clear(BANKS_LIST, g_banks);
 
-	//restore our previous hover / selected bank
-	g_banks->hover = prev_hover;
-	g_banks->selected = prev_selected;
+    g_banks->hover = g_current_bank;
+    g_banks->selected = g_current_bank;
+
+    return 1;
 }
 
 //called from the request functions and the naveg_initail_state
 static void parse_pedalboards_list(void *data, menu_item_t *item)
 {
     (void) item;
-    char **list = data;
-    uint32_t count = strarr_length(&list[5]);
+    bp_list_t *page = bp_parse(PEDALBOARD_LIST, data);
 
-    // workaround freeze when opening menu
-    delay_ms(20);
+    if (!page) return;
 
-    // free the navigation pedalboads list
-    if (g_naveg_pedalboards)
-        data_free_pedalboards_list(g_naveg_pedalboards);
-
-    // parses the list
-    g_naveg_pedalboards = data_parse_pedalboards_list(&list[5], count);
+    bp_cache_store(PEDALBOARD_LIST, page);
+    g_naveg_pedalboards = page;
+}
 
-    if (g_naveg_pedalboards)
-    {
-    	g_naveg_pedalboards->menu_max = (atoi(list[2]));
-    	g_naveg_pedalboards->page_min = (atoi(list[3]));
-    	g_naveg_pedalboards->page_max = (atoi(list[4])); 
-    }
+static void prefetch_pedalboards_page(void *data, menu_item_t *item)
+{
+    (void) item;
+    prefetch_page(PEDALBOARD_LIST, data);
 }
 
 //requested when clicked on a back
-static void request_pedalboards(uint8_t dir, uint16_t bank_uid)
+// returns zero if the list wasn't received
+static uint8_t request_pedalboards(uint8_t dir, uint16_t bank_uid)
 {
-	uint8_t i;
+	uint8_t i, received;
 	char buffer[40];
 	memset(buffer, 0, sizeof buffer);
 
-    // sets the response callback
-    comm_webgui_set_response_cb(parse_pedalboards_list, NULL);
-
     i = copy_command((char *)buffer, CMD_PEDALBOARDS);
 
     uint8_t bitmask = 0;
@@ -894,26 +1732,214 @@ static void request_pedalboards(uint8_t dir, uint16_t bank_uid)
     	prev_selected = g_naveg_pedalboards->selected;
     }
     
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_NAVEG);
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    // sends the data to GUI and waits the pedalboards list be received
+    received = comm_webgui_wait_response(comm_webgui_request(buffer, i, parse_pedalboards_list, NULL, 0));
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+    protocol_unlock(LINK_OWNER_NAVEG);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    // the navigation state was reset by a gui connection change
+    if (!received || !g_banks || !g_naveg_pedalboards) return 0;
 
-    if (g_naveg_pedalboards)
+    // the pages of other banks are dropped
+    bp_cache_clear(PEDALBOARD_LIST, g_naveg_pedalboards);
+
+    g_naveg_pedalboards->hover = prev_hover;
+    g_naveg_pedalboards->selected = prev_selected;
+
+    return 1;
+}
+
+// requests the page around the hover, the async requests are stored by the protocol task as prefetched
+// returns zero if a sync page wasn't received
+static uint8_t request_bp_page(uint8_t list, uint8_t dir, uint16_t hover, uint8_t async)
+{
+    uint8_t i, received;
+    char buffer[40];
+    memset(buffer, 0, sizeof buffer);
+
+    if (list == BANKS_LIST)
+    {
+        i = copy_command(buffer, CMD_BANKS);
+
+        // insert the direction on buffer
+        i += int_to_str(dir, &buffer[i], sizeof(buffer) - i, 0);
+
+        // inserts one space
+        buffer[i++] = ' ';
+
+        i += int_to_str(hover, &buffer[i], sizeof(buffer) - i, 0);
+    }
+    else
+    {
+        i = copy_command(buffer, CMD_PEDALBOARDS);
+
+        // insert the direction on buffer
+        i += int_to_str((dir == PAGE_DIR_UP) ? FLAG_PAGINATION_PAGE_UP : 0, &buffer[i], sizeof(buffer) - i, 0);
+
+        // inserts one space
+        buffer[i++] = ' ';
+
+        // the pedalboards list is shifted by the "> back to banks" item
+        i += int_to_str(hover - 1, &buffer[i], sizeof(buffer) - i, 0);
+
+        // inserts one space
+        buffer[i++] = ' ';
+
+        // copy the bank uid, index is relevant in the array so - page_min
+        i += int_to_str(atoi(g_banks->uids[g_banks->hover - g_banks->page_min]), &buffer[i], sizeof(buffer) - i, 0);
+
+        buffer[i++] = 0;
+    }
+
+    if (async)
+    {
+        bp_cache_t *cache = &g_bp_cache[list];
+
+        cache->prefetching = 1;
+        cache->prefetch_serial = cache->serial;
+
+        // the user keeps scrolling while the page is received
+        comm_webgui_request(buffer, i, (list == BANKS_LIST) ? prefetch_banks_page : prefetch_pedalboards_page, NULL,
+                            WEBGUI_ASYNC_TIMEOUT);
+        return 1;
+    }
+
+    protocol_lock(LINK_OWNER_NAVEG);
+
+    // sends the data to GUI and waits the page be received
+    received = comm_webgui_wait_response(comm_webgui_request(buffer, i,
+                                         (list == BANKS_LIST) ? parse_banks_list : parse_pedalboards_list, NULL, 0));
+
+    protocol_unlock(LINK_OWNER_NAVEG);
+
+    return (received && *bp_current(list));
+}
+
+// requests the next page in the scroll direction before the hover gets there
+static void bp_prefetch(uint8_t list, uint8_t dir)
+{
+    bp_cache_t *cache = &g_bp_cache[list];
+    bp_list_t *page = *bp_current(list);
+    uint16_t edge;
+
+    // comm expiry calls back the request that isn't answered
+    if (cache->prefetching) return;
+
+    // first hover which needs other page
+    if (dir == PAGE_DIR_UP)
+    {
+        if (page->page_max == page->menu_max) return;
+
+        edge = page->page_max - g_bp_margin_max[list];
+        if (page->hover + NAVEG_PREFETCH_ITEMS < edge) return;
+    }
+    else
+    {
+        if (page->page_min == 0) return;
+
+        edge = page->page_min + g_bp_margin_min[list];
+        if (page->hover > edge + NAVEG_PREFETCH_ITEMS) return;
+    }
+
+    if (!bp_cache_find(list, edge, dir))
+        request_bp_page(list, dir, edge, 1);
+}
+
+// called after the hover moves, turns to other page when the current one has no items in front of the hover
+// returns zero if the page wasn't received
+static uint8_t bp_scroll(uint8_t list, uint8_t dir)
+{
+    bp_list_t **current = bp_current(list);
+    uint16_t hover = (*current)->hover;
+    uint16_t selected = (*current)->selected;
+
+    if (!bp_page_has(list, *current, hover, dir))
+    {
+        bp_list_t *page = bp_cache_find(list, hover, dir);
+
+        if (page) *current = page;
+        else if (!request_bp_page(list, dir, hover, 0)) return 0;
+
+        // the parsed pages don't have the navigation state
+        (*current)->hover = hover;
+        (*current)->selected = selected;
+    }
+
+    bp_prefetch(list, dir);
+
+    return 1;
+}
+
+static const char *footswitch_pb_name(uint16_t pedalboard)
+{
+    bp_list_t *list = &g_footswitch_pedalboards;
+
+    // index is relevant thats why - page_min, the first name is "> back to banks"
+    if (!list->names || pedalboard <= list->page_min || pedalboard > list->page_max) return NULL;
+
+    return list->names[pedalboard - list->page_min];
+}
+
+static void pb_name_show(const char *name)
+{
+    const char *name_list[2] = {name, NULL};
+
+    if (name) screen_pb_name(name_list, 1);
+}
+
+static void pb_name_copy(char *dest, const char *name)
+{
+    strncpy(dest, name ? name : "", sizeof(g_pb_load.name) - 1);
+    dest[sizeof(g_pb_load.name) - 1] = 0;
+}
+
+// called before the HMI switches the pedalboard, keeps the state to roll back if nothing is waiting confirmation
+static void pb_load_begin(void)
+{
+    if (g_pb_load.serial == g_pb_load.confirmed_serial)
     {
-    	g_naveg_pedalboards->hover = prev_hover;
-    	g_naveg_pedalboards->selected = prev_selected;
+        g_pb_load.bank = g_current_bank;
+        g_pb_load.pedalboard = g_current_pedalboard;
+        pb_name_copy(g_pb_load.name, footswitch_pb_name(g_current_pedalboard));
     }
+
+    g_pb_load.serial++;
 }
 
-static void send_load_pedalboard(uint16_t bank_id, const char *pedalboard_uid)
+static void pb_load_rollback(void)
+{
+    g_current_bank = g_pb_load.bank;
+    g_current_pedalboard = g_pb_load.pedalboard;
+
+    if (g_banks) g_banks->selected = g_current_bank;
+
+    if (g_naveg_pedalboards && g_banks && g_banks->hover == g_current_bank)
+        g_naveg_pedalboards->selected = g_current_pedalboard;
+
+    if (g_pb_load.name[0]) pb_name_show(g_pb_load.name);
+
+    if (footswitch_pb_name(g_current_pedalboard)) bank_config_footer();
+
+    if (tool_is_on(DISPLAY_TOOL_NAVIG) && g_bp_state == PEDALBOARD_LIST && g_naveg_pedalboards)
+        screen_bp_list(g_banks->names[g_banks->hover - g_banks->page_min], g_naveg_pedalboards);
+}
+
+// load response, runs on the protocol task or on the display task when it expires
+static void pedalboard_loaded(void *data, menu_item_t *item)
+{
+    (void) item;
+    char **list = data;
+
+    // without response the load is still considered done, webgui reports the pedalboard changes anyway
+    g_pb_load.failed = (list && strarr_length(list) > 1 && atoi(list[1]) < 0);
+    g_pb_load.answered = 1;
+
+    actuators_wake();
+}
+
+static void pb_load_send(void)
 {
     uint16_t i;
     char buffer[40];
@@ -922,12 +1948,12 @@ static void send_load_pedalboard(uint16_t bank_id, const char *pedalboard_uid)
     i = copy_command((char *)buffer, CMD_PEDALBOARD_LOAD);
 
     // copy the bank id
-    i += int_to_str(bank_id, &buffer[i], 8, 0);
+    i += int_to_str(g_pb_load.next_bank_id, &buffer[i], 8, 0);
 
     // inserts one space
     buffer[i++] = ' ';
 
-	const char *p = pedalboard_uid;
+	const char *p = g_pb_load.next_uid;
     // copy the pedalboard uidf
     if (!*p) 
    	{
@@ -943,26 +1969,58 @@ static void send_load_pedalboard(uint16_t bank_id, const char *pedalboard_uid)
 	}
     buffer[i] = 0;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
-
-    // sets the response callback
-    comm_webgui_set_response_cb(NULL, NULL);
+    g_pb_load.sent_serial = g_pb_load.next_serial;
+    g_pb_load.sent_bank = g_pb_load.next_bank;
+    g_pb_load.sent_pedalboard = g_pb_load.next_pedalboard;
+    memcpy(g_pb_load.sent_name, g_pb_load.next_name, sizeof(g_pb_load.name));
+    g_pb_load.loading = 1;
 
     // send the data to GUI
-    comm_webgui_send(buffer, i);
+    comm_webgui_request(buffer, i, pedalboard_loaded, NULL, PEDALBOARD_LOAD_TIMEOUT);
+}
+
+static void pb_load_answered(void)
+{
+    g_pb_load.answered = 0;
+    g_pb_load.loading = 0;
+
+    if (g_pb_load.failed)
+    {
+        // a newer switch made meanwhile is resolved by its own response
+        if (g_pb_load.sent_serial == g_pb_load.serial)
+        {
+            pb_load_rollback();
+            g_pb_load.confirmed_serial = g_pb_load.serial;
+        }
+    }
+    else
+    {
+        g_pb_load.bank = g_pb_load.sent_bank;
+        g_pb_load.pedalboard = g_pb_load.sent_pedalboard;
+        memcpy(g_pb_load.name, g_pb_load.sent_name, sizeof(g_pb_load.name));
+        g_pb_load.confirmed_serial = g_pb_load.sent_serial;
+    }
 
-    // waits the pedalboard loaded message to be received
-    comm_webgui_wait_response();
+    if (g_pb_load.next_serial != g_pb_load.sent_serial) pb_load_send();
+}
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+// the HMI state must be already switched, webgui loads the pedalboard in background
+static void send_load_pedalboard(uint16_t bank_id, const char *pedalboard_uid, const char *name)
+{
+    g_pb_load.next_serial = g_pb_load.serial;
+    g_pb_load.next_bank = g_current_bank;
+    g_pb_load.next_pedalboard = g_current_pedalboard;
+    g_pb_load.next_bank_id = bank_id;
+    strncpy(g_pb_load.next_uid, pedalboard_uid, sizeof(g_pb_load.next_uid) - 1);
+    g_pb_load.next_uid[sizeof(g_pb_load.next_uid) - 1] = 0;
+    pb_name_copy(g_pb_load.next_name, name);
+
+    // the load in progress is answered before the next one is sent
+    if (!g_pb_load.loading) pb_load_send();
 }
 
 static void control_set(uint8_t id, control_t *control)
 {
-    uint32_t now, delta;
-
     if ((control->properties & (FLAG_CONTROL_REVERSE | FLAG_CONTROL_ENUMERATION | FLAG_CONTROL_SCALE_POINTS)) && !(control->properties & FLAG_CONTROL_MOMENTARY))
     {
         //encoder (pagination is done in the increment / decrement functions)
@@ -1009,7 +2067,7 @@ static void control_set(uint8_t id, control_t *control)
         			{
                         if (control->scale_points_flag & FLAG_SCALEPOINT_PAGINATED)
                         {
-                            request_control_page(control, 1);
+                            request_control_page(control, 1, 0);
                             return;
                         }
                         else
@@ -1025,7 +2083,7 @@ static void control_set(uint8_t id, control_t *control)
         		else if (control->scale_points_flag & FLAG_SCALEPOINT_PAGINATED) 
         		{
         			//request new data, a new control we be assigned after
-        			request_control_page(control, 1);
+        			request_control_page(control, 1, 0);
 
         			//since a new control is assigned we can return
         			return;
@@ -1044,7 +2102,7 @@ static void control_set(uint8_t id, control_t *control)
         		else if ((control->scale_points_flag & (FLAG_SCALEPOINT_PAGINATED | FLAG_SCALEPOINT_WRAP_AROUND)))
         		{
         		    //request new data, a new control we be assigned after
-        		    request_control_page(control, 0);
+        		    request_control_page(control, 0, 0);
 
             	//since a new control is assigned we can return
     	   		return;
@@ -1107,36 +2165,18 @@ static void control_set(uint8_t id, control_t *control)
     }
     else if (control->properties & FLAG_CONTROL_TAP_TEMPO)
     {
-        now = hardware_timestamp();
-        delta = now - g_tap_tempo[control->hw_id - ENCODERS_COUNT].time;
-        g_tap_tempo[control->hw_id - ENCODERS_COUNT].time = now;
+        uint8_t foot = control->hw_id - ENCODERS_COUNT;
 
-        if (g_tap_tempo[control->hw_id - ENCODERS_COUNT].state == TT_COUNTING)
+        if (g_tap_tempo[foot].state == TT_COUNTING)
         {
-            // checks if delta almost suits maximum allowed value
-            if ((delta > g_tap_tempo[control->hw_id - ENCODERS_COUNT].max) &&
-                ((delta - TAP_TEMPO_MAXVAL_OVERFLOW) < g_tap_tempo[control->hw_id - ENCODERS_COUNT].max))
-            {
-                // sets delta to maxvalue if just slightly over, instead of doing nothing
-                delta = g_tap_tempo[control->hw_id - ENCODERS_COUNT].max;
-            }
+            // the period is estimated from the press times taken by the actuators ISR
+            uint32_t period_us = tap_tempo_tap(foot, g_tap_tempo[foot].max * 1000);
 
-            // checks the tap tempo timeout
-            if (delta <= g_tap_tempo[control->hw_id - ENCODERS_COUNT].max)
+            if (period_us)
             {
-                //get current value of tap tempo in ms
-                float currentTapVal = convert_to_ms(control->unit, control->value);
-                //check if it should be added to running average
-                if (fabs(currentTapVal - delta) < TAP_TEMPO_TAP_HYSTERESIS)
-                {
-                    // converts and update the tap tempo value
-                    control->value = (2*(control->value) + convert_from_ms(control->unit, delta)) / 3;
-                }
-                else
-                {
-                    // converts and update the tap tempo value
-                    control->value = convert_from_ms(control->unit, delta);
-                }
+                // converts and update the tap tempo value
+                control->value = convert_from_ms(control->unit, period_us * 0.001f);
+
                 // checks the values bounds
                 if (control->value > control->maximum) control->value = control->maximum;
                 if (control->value < control->minimum) control->value = control->minimum;
@@ -1166,27 +2206,30 @@ static void control_set(uint8_t id, control_t *control)
     buffer[i++] = ' ';
 
     // insert the value on buffer
-    i += float_to_str(control->value, &buffer[i], sizeof(buffer) - i, 3);
+    if (control->decimals != FIXED_NONE)
+        i += fixed_to_str(control->fixed_value, control->decimals, &buffer[i], sizeof(buffer) - i, 3);
+    else
+        i += float_to_str(control->value, &buffer[i], sizeof(buffer) - i, 3);
     buffer[i] = 0;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_NAVEG);
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    // sends the data to GUI, the response is consumed even when it's not waited
+    uint32_t request = comm_webgui_send(buffer, i);
 
     //wait for a response from mod-ui
     if (g_should_wait_for_webgui) {
-        comm_webgui_wait_response();
+        comm_webgui_wait_response(request);
     }
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_NAVEG);
 }
 
 static void bp_enter(void)
 {
     const char *title;
+    const char *load_uid = NULL, *load_name = NULL;
+    uint16_t load_bank = 0;
 
     if (naveg_ui_status())
     {
@@ -1206,7 +2249,7 @@ static void bp_enter(void)
             g_naveg_pedalboards->hover = g_current_pedalboard;
 
     	//index is relevent in our array so - page_min
-        request_pedalboards(PAGE_DIR_INIT, atoi(g_banks->uids[g_banks->hover - g_banks->page_min]));
+        if (!request_pedalboards(PAGE_DIR_INIT, atoi(g_banks->uids[g_banks->hover - g_banks->page_min]))) return;
 
         // if reach here, received the pedalboards list
         g_bp_state = PEDALBOARD_LIST;
@@ -1227,9 +2270,13 @@ static void bp_enter(void)
             g_bp_first=0;
             g_pb_footswitches = 1; 
 
-            // request to GUI load the pedalboard
+            // the pedalboard is shown as loaded before webgui loads it
+            pb_load_begin();
+
             //index is relevant in the array so - page_min, also the HMI array is always shifted right 1 because of back to banks, correct here
-            send_load_pedalboard(atoi(g_banks->uids[g_banks->hover - g_banks->page_min]), g_naveg_pedalboards->uids[g_naveg_pedalboards->hover - g_naveg_pedalboards->page_min - 1]);
+            load_bank = atoi(g_banks->uids[g_banks->hover - g_banks->page_min]);
+            load_uid = g_naveg_pedalboards->uids[g_naveg_pedalboards->hover - g_naveg_pedalboards->page_min - 1];
+            load_name = g_naveg_pedalboards->names[g_naveg_pedalboards->hover - g_naveg_pedalboards->page_min];
 
             g_current_pedalboard = g_naveg_pedalboards->hover;
 
@@ -1261,6 +2308,15 @@ static void bp_enter(void)
     }
 
     screen_bp_list(title, (g_bp_state == PEDALBOARD_LIST)? g_naveg_pedalboards : g_banks);
+
+    if (load_uid)
+    {
+        pb_name_show(load_name);
+        bank_config_footer();
+
+        // request to GUI load the pedalboard
+        send_load_pedalboard(load_bank, load_uid, load_name);
+    }
 }
 
 static void bp_up(void)
@@ -1272,79 +2328,25 @@ static void bp_up(void)
 
     if (g_bp_state == BANKS_LIST)
     {
-    	//if we are nearing the final 3 items of the page, and we already have the end of the page in memory, or if we just need to go down
-    	if(g_banks->page_min == 0) 
-    	{
-    		//check if we are not already at the end
-    		if (g_banks->hover == 0) return;
-    		else 
-    		{
-        		//we still have banks in our list
-         		g_banks->hover--;
-
-         		bp_list = g_banks;
-        		title = "BANKS";
-    		}
-    	}
-    	//are we comming from the bottom of the menu?
-    	else
-    	{
-    		//we always keep 3 items in front of us, if not request new page
-    		if (g_banks->hover <= (g_banks->page_min + 3))
-    		{
-    			g_banks->hover--;
-        		title = "BANKS";
-
-    			//request new page
-    			request_next_bank_page(PAGE_DIR_DOWN);
-
-                bp_list = g_banks;
-    		}	
-    		//we have items, just go up
-    		else 
-    		{
-         		g_banks->hover--;
-         		bp_list = g_banks;
-        		title = "BANKS";
-    		}
-    	}
+        //check if we are not already at the top
+        if (g_banks->hover == 0) return;
+
+        g_banks->hover--;
+        if (!bp_scroll(BANKS_LIST, PAGE_DIR_DOWN)) return;
+
+        bp_list = g_banks;
+        title = "BANKS";
     }
     else if (g_bp_state == PEDALBOARD_LIST)
     {
-    	//are we reaching the bottom of the menu?
-    	if(g_naveg_pedalboards->page_min == 0) 
-    	{
-    		//check if we are not already at the end
-    		if (g_naveg_pedalboards->hover == 0) return;
-    		else 
-    		{
-    			//go down till the end
-    			//we still have items in our list
-         		g_naveg_pedalboards->hover--;
-         		bp_list = g_naveg_pedalboards;
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-        	}
-    	}
-    	else
-    	{
-    		//we always keep 3 items in front of us, if not request new page, we add 4 because the bottom item is always "> back to banks" and we dont show that here
-    		if (g_naveg_pedalboards->hover <= (g_naveg_pedalboards->page_min + 5))
-    		{
-    			g_naveg_pedalboards->hover--;
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-    			//request new page
-    			request_pedalboards(PAGE_DIR_DOWN, atoi(g_banks->uids[g_banks->hover - g_banks->page_min]));
-
-                bp_list = g_naveg_pedalboards;
-    		}	
-    		//we have items, just go up
-    		else 
-    		{
-         		g_naveg_pedalboards->hover--;
-         		bp_list = g_naveg_pedalboards;
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-    		}
-    	}
+        //check if we are not already at the top
+        if (g_naveg_pedalboards->hover == 0) return;
+
+        g_naveg_pedalboards->hover--;
+        if (!bp_scroll(PEDALBOARD_LIST, PAGE_DIR_DOWN)) return;
+
+        bp_list = g_naveg_pedalboards;
+        title = g_banks->names[g_banks->hover - g_banks->page_min];
     }
     else return;
 
@@ -1360,75 +2362,26 @@ static void bp_down(void)
 
     if (g_bp_state == BANKS_LIST)
     {
-    	//are we reaching the bottom of the menu?
-    	if(g_banks->page_max == g_banks->menu_max) 
-    	{
-    		//check if we are not already at the end
-    		if (g_banks->hover >= g_banks->menu_max -1) return;
-    		else 
-    		{
-        		//we still have banks in our list
-         		g_banks->hover++;
-         		bp_list = g_banks;
-        		title = "BANKS";
-    		}
-    	}
-    	else 
-    	{
-    		//we always keep 3 items in front of us, if not request new page
-    		if (g_banks->hover >= (g_banks->page_max - 4))
-    		{
-    			g_banks->hover++;
-        		title = "BANKS";
-    			//request new page
-    			request_next_bank_page(PAGE_DIR_UP);
-
-                bp_list = g_banks;
-    		}	
-    		//we have items, just go down
-    		else 
-    		{
-         		g_banks->hover++;
-         		bp_list = g_banks;
-        		title = "BANKS";
-    		}
-    	}
+        //check if we are not already at the end of the last page
+        if (g_banks->page_max == g_banks->menu_max && g_banks->hover >= g_banks->menu_max - 1) return;
+
+        g_banks->hover++;
+        if (!bp_scroll(BANKS_LIST, PAGE_DIR_UP)) return;
+
+        bp_list = g_banks;
+        title = "BANKS";
     }
     else if (g_bp_state == PEDALBOARD_LIST)
     {
-    	//are we reaching the bottom of the menu, -1 because menu max is bigger then page_max
-    	if(g_naveg_pedalboards->page_max == g_naveg_pedalboards->menu_max) 
-    	{
-    		//check if we are not already at the end, we dont need so substract by one, since the "> back to banks" item is added on parsing
-    		if (g_naveg_pedalboards->hover == g_naveg_pedalboards->menu_max) return;
-    		else 
-    		{
-    			//we still have items in our list
-         		g_naveg_pedalboards->hover++;
-         		bp_list = g_naveg_pedalboards;
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-    		}
-    	}
-    	else 
-    	{
-    		//we always keep 3 items in front of us, if not request new page, we need to substract by 5, since the "> back to banks" item is added on parsing 
-    		if (g_naveg_pedalboards->hover >= (g_naveg_pedalboards->page_max - 4))
-    		{
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-    			//request new page
-    			request_pedalboards(PAGE_DIR_UP, atoi(g_banks->uids[g_banks->hover - g_banks->page_min]));
-
-                g_naveg_pedalboards->hover++;
-                bp_list = g_naveg_pedalboards;
-    		}	
-    		//we have items, just go down
-    		else 
-    		{
-         		g_naveg_pedalboards->hover++;
-         		bp_list = g_naveg_pedalboards;
-        		title = g_banks->names[g_banks->hover - g_banks->page_min];
-    		}
-    	}
+        //we dont need so substract by one, since the "> back to banks" item is added on parsing
+        if (g_naveg_pedalboards->page_max == g_naveg_pedalboards->menu_max &&
+            g_naveg_pedalboards->hover == g_naveg_pedalboards->menu_max) return;
+
+        g_naveg_pedalboards->hover++;
+        if (!bp_scroll(PEDALBOARD_LIST, PAGE_DIR_UP)) return;
+
+        bp_list = g_naveg_pedalboards;
+        title = g_banks->names[g_banks->hover - g_banks->page_min];
     }
     else return;
 
@@ -1825,17 +2778,12 @@ static void tuner_enter(void)
     i += int_to_str(input, &buffer[i], sizeof(buffer) - i, 0);
     buffer[i] = 0;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
-
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+    protocol_lock(LINK_OWNER_NAVEG);
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+    // sends the data to GUI and waits the response
+    comm_webgui_wait_response(comm_webgui_send(buffer, i));
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_NAVEG);
 
     // updates the screen
     screen_tuner_input(input);
@@ -1880,43 +2828,55 @@ static void reset_menu_hover(node_t *menu_node)
     }
 }
 
-static void parse_footswitch_pedalboards_list(void *data, menu_item_t *item)
+// runs on the protocol task or on the display task when it expires
+static void footswitch_page_received(void *data, menu_item_t *item)
 {
     (void) item;
-    char **list = data;
+    bp_list_t *page = data ? bp_parse(PEDALBOARD_LIST, data) : NULL;
+    bp_list_t *old;
 
-    uint32_t count = strarr_length(&list[5]);
+    taskENTER_CRITICAL();
+    old = g_footswitch_page.received;
+    g_footswitch_page.received = page;
+    g_footswitch_page.requesting = 0;
+    taskEXIT_CRITICAL();
 
-    // workaround freeze when opening menu
-    delay_ms(20);
+    if (old) data_free_pedalboards_list(old);
 
-    // parses the list
-    bp_list_t *pb_list_bfr = data_parse_pedalboards_list(&list[5], count);
+    actuators_wake();
+}
 
-    if (pb_list_bfr)
-    {
-        str_array_free(g_footswitch_pedalboards.names);
-        str_array_free(g_footswitch_pedalboards.uids);
-        memcpy(&g_footswitch_pedalboards, pb_list_bfr, sizeof(bp_list_t));
-        g_footswitch_pedalboards.names = str_array_duplicate(pb_list_bfr->names, (g_naveg_pedalboards->page_max - g_naveg_pedalboards->page_min + 1));
-        g_footswitch_pedalboards.uids  = str_array_duplicate(pb_list_bfr->uids, (g_naveg_pedalboards->page_max - g_naveg_pedalboards->page_min + 1));
-    }
+static void footswitch_page_install(void)
+{
+    bp_list_t *page;
+
+    taskENTER_CRITICAL();
+    page = g_footswitch_page.received;
+    g_footswitch_page.received = NULL;
+    taskEXIT_CRITICAL();
+
+    if (!page) return;
+
+    str_array_free(g_footswitch_pedalboards.names);
+    str_array_free(g_footswitch_pedalboards.uids);
+    memcpy(&g_footswitch_pedalboards, page, sizeof(bp_list_t));
+    g_footswitch_pedalboards.names = str_array_duplicate(page->names, (page->page_max - page->page_min + 1));
+    g_footswitch_pedalboards.uids  = str_array_duplicate(page->uids, (page->page_max - page->page_min + 1));
 
-    g_footswitch_pedalboards.menu_max = (atoi(list[2]));
-    g_footswitch_pedalboards.page_min = (atoi(list[3]));
-    g_footswitch_pedalboards.page_max = (atoi(list[4])); 
+    data_free_pedalboards_list(page);
 
-    data_free_pedalboards_list(pb_list_bfr);
+    // the footer shows the pedalboards around the current one
+    if (footswitch_pb_name(g_current_pedalboard)) bank_config_footer();
 }
 
+// the page is received in background, the footswitches only wait it when they go beyond the current page
 static void request_footswitch_pedalboards(uint8_t dir)
 {
 	uint8_t i;
 	char buffer[40];
 	memset(buffer, 0, sizeof buffer);
 
-	// sets the response callback
-	comm_webgui_set_response_cb(parse_footswitch_pedalboards_list, NULL);
+	if (g_footswitch_page.requesting) return;
 
 	//create the command
 	i = copy_command((char *)buffer, CMD_PEDALBOARDS);
@@ -1941,17 +2901,10 @@ static void request_footswitch_pedalboards(uint8_t dir)
 
     buffer[i++] = 0;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    g_footswitch_page.requesting = 1;
 
     // sends the data to GUI
-    comm_webgui_send(buffer, i);
-
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
-
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    comm_webgui_request(buffer, i, footswitch_page_received, NULL, WEBGUI_ASYNC_TIMEOUT);
 }
 
 static uint8_t bank_config_check(uint8_t foot)
@@ -1973,55 +2926,60 @@ static uint8_t bank_config_check(uint8_t foot)
 static void bank_config_update(uint8_t bank_func_idx)
 {
     uint8_t i = bank_func_idx;
+    uint16_t pedalboard = g_current_pedalboard;
+    uint8_t dir;
 
     switch (g_bank_functions[i].function)
     {
         case BANK_FUNC_PEDALBOARD_NEXT:
-            	//check if we need to request a new page
-            	if (g_current_pedalboard >= g_footswitch_pedalboards.page_max - 1)
-            	{
-            		//we do not request a new page when there is none
-            		if (g_footswitch_pedalboards.page_max == g_footswitch_pedalboards.menu_max)
-            		{
-            			if (g_current_pedalboard == g_footswitch_pedalboards.menu_max) return;
-            			else g_current_pedalboard++;
-            		}
-            		else
-           			{
- 						g_current_pedalboard++;
-            			request_footswitch_pedalboards(PAGE_DIR_UP);
-            		}
-            	}
-            	else g_current_pedalboard++;
-
-                send_load_pedalboard(g_current_bank, g_footswitch_pedalboards.uids[g_current_pedalboard - g_footswitch_pedalboards.page_min - 1]);
+            //we do not go further when there is no next pedalboard
+            if (g_footswitch_pedalboards.page_max == g_footswitch_pedalboards.menu_max &&
+                pedalboard == g_footswitch_pedalboards.menu_max) return;
 
+            pedalboard++;
+            dir = PAGE_DIR_UP;
             break;
 
-        case BANK_FUNC_PEDALBOARD_PREV:           
-				//check if we are reaching the max of the page
-            	if (g_current_pedalboard <= g_footswitch_pedalboards.page_min + 2)
-            	{
-            		if (g_footswitch_pedalboards.page_min == 0)
-            		{
-            			//we do not request a new page when there is none
-            			if (g_current_pedalboard ==  1) return;
-            			else g_current_pedalboard--;
-            		}
-
-            		else
-            		{
-            			g_current_pedalboard--;
-
-            			request_footswitch_pedalboards(PAGE_DIR_DOWN);
-            		}
-            	}
-            	//just go to the end
-            	else g_current_pedalboard--;
-
-                send_load_pedalboard(g_current_bank, g_footswitch_pedalboards.uids[g_current_pedalboard - g_footswitch_pedalboards.page_min - 1]);
-            
+        case BANK_FUNC_PEDALBOARD_PREV:
+            //we do not go further when there is no previous pedalboard
+            if (g_footswitch_pedalboards.page_min == 0 && pedalboard == 1) return;
+
+            pedalboard--;
+            dir = PAGE_DIR_DOWN;
             break;
+
+        default:
+            return;
+    }
+
+    const char *name = footswitch_pb_name(pedalboard);
+
+    // the page in front is still being received, the press is dropped
+    if (!name)
+    {
+        request_footswitch_pedalboards(dir);
+        return;
+    }
+
+    // the pedalboard is shown as loaded before webgui loads it
+    pb_load_begin();
+    g_current_pedalboard = pedalboard;
+
+    pb_name_show(name);
+    bank_config_footer();
+
+    send_load_pedalboard(g_current_bank, g_footswitch_pedalboards.uids[pedalboard - g_footswitch_pedalboards.page_min - 1], name);
+
+    //check if we need to request a new page, we keep one pedalboard in front of the current one
+    if (dir == PAGE_DIR_UP && pedalboard >= g_footswitch_pedalboards.page_max &&
+        g_footswitch_pedalboards.page_max != g_footswitch_pedalboards.menu_max)
+    {
+        request_footswitch_pedalboards(PAGE_DIR_UP);
+    }
+    else if (dir == PAGE_DIR_DOWN && pedalboard <= g_footswitch_pedalboards.page_min + 1 &&
+             g_footswitch_pedalboards.page_min != 0)
+    {
+        request_footswitch_pedalboards(PAGE_DIR_DOWN);
     }
 }
 
@@ -2233,14 +3191,16 @@ void naveg_initial_state(uint16_t max_menu, uint16_t page_min, uint16_t page_max
         g_banks->hover = bank_id;
     }
 
-    // checks and free the navigation pedalboads list
-    if (g_naveg_pedalboards) data_free_pedalboards_list(g_naveg_pedalboards);
+    // drops the cached navigation pedalboads pages
+    bp_cache_clear(PEDALBOARD_LIST, NULL);
 
     // parses the list
     g_naveg_pedalboards = data_parse_pedalboards_list(pedalboards_list, strarr_length(pedalboards_list));
 
     if (!g_naveg_pedalboards) return;
 
+    bp_cache_store(PEDALBOARD_LIST, g_naveg_pedalboards);
+
     g_naveg_pedalboards->page_min = page_min;
     g_naveg_pedalboards->page_max = page_max;
     g_naveg_pedalboards->menu_max = max_menu;
@@ -2276,8 +3236,8 @@ void naveg_ui_connection(uint8_t status)
         g_ui_connected = 0;
 
         // reset the banks and pedalboards state after return from ui connection
-        if (g_banks) data_free_banks_list(g_banks);
-        if (g_naveg_pedalboards) data_free_pedalboards_list(g_naveg_pedalboards);
+        bp_cache_clear(BANKS_LIST, NULL);
+        bp_cache_clear(PEDALBOARD_LIST, NULL);
         g_banks = NULL;
         g_naveg_pedalboards = NULL;
     }
@@ -2309,12 +3269,44 @@ void naveg_add_control(control_t *control, uint8_t protocol)
     if (!g_initialized) return;
     if (!control) return;
 
+    // webgui sends the assignments again, the untagged set wasn't restored
+    if (protocol)
+    {
+        uint8_t i;
+        for (i = 0; i < NAVEG_UI_CACHE_SETS; i++)
+        {
+            if (g_ui_snapshots[i].valid && !g_ui_snapshots[i].uid) ui_snapshot_free(&g_ui_snapshots[i]);
+        }
+    }
+
+    if (control->hw_id < ENCODERS_COUNT)
+    {
+        struct CONTROL_RING_T *ring = &g_control_rings[control->hw_id];
+
+        // a page of the shown control
+        if (!protocol)
+        {
+            control_ring_replace(control);
+            display_control_add(control);
+            return;
+        }
+
+        // the control waits the index sent by webgui after it, it's only shown if the index is still the current one
+        control_t *previous = ring->added;
+        ring->added = control;
+        control_ring_release(control->hw_id, previous);
+
+        if (ring->switches) display_control_init(control);
+        else display_control_add(control);
+        return;
+    }
+
     // first tries remove the control
     naveg_remove_control(control->hw_id);
 
-    if (control->hw_id < ENCODERS_COUNT)
+    if (control->hw_id >= EXPRESSION0 && control->hw_id < (EXPRESSION0 + EXPRESSIONS_COUNT))
     {
-        display_control_add(control);
+        expression_control_add(control);
     }
     else
     {
@@ -2329,10 +3321,11 @@ void naveg_remove_control(uint8_t hw_id)
     if (!g_initialized) return;
 
     if ((hw_id == 0) || (hw_id == 1)) display_control_rm(hw_id);
+    else if (hw_id >= EXPRESSION0 && hw_id < (EXPRESSION0 + EXPRESSIONS_COUNT)) expression_control_rm(hw_id);
     else foot_control_rm(hw_id);
 }
 
-void naveg_inc_control(uint8_t display)
+void naveg_inc_control(uint8_t display, uint8_t steps)
 {
     if (!g_initialized) return;
 
@@ -2348,18 +3341,29 @@ void naveg_inc_control(uint8_t display)
             //sets the direction
             control->scroll_dir = g_scroll_dir = 0;
 
-            // increments the step
-            if (control->step < (control->steps - 3))
+            scale_window_collect(display);
+
+            // increments the step inside the window
+            if (control->step < (control->steps - 1))
                 control->step++;
-            //we are at the end of our list ask for more data
+            else if (g_scale_windows[display].last)
+                return;
+            //the window didn't get the next page in time, ask for it
             else
             {
                 //request new data, a new control we be assigned after
-                request_control_page(control, 1);
+                request_control_page(control, 1, 0);
 
                 //since a new control is assigned we can return
                 return;
             }
+
+            step_to_value(control);
+            control_set(display, control);
+
+            // the next page is requested while the user is still turning
+            scale_window_prefetch(display, 1);
+            return;
         }
         else {
             // increments the step
@@ -2385,9 +3389,12 @@ void naveg_inc_control(uint8_t display)
     }
     else
     {
-        // increments the step
+        // increments the step, accelerated moves jump several steps in a single control_set
         if (control->step < (control->steps - 1))
-            control->step++;
+        {
+            if (steps > (control->steps - 1 - control->step)) control->step = control->steps - 1;
+            else control->step += steps;
+        }
         else
             return;
     }
@@ -2398,7 +3405,7 @@ void naveg_inc_control(uint8_t display)
     control_set(display, control);
 }
 
-void naveg_dec_control(uint8_t display)
+void naveg_dec_control(uint8_t display, uint8_t steps)
 {    
     if (!g_initialized) return;
 
@@ -2414,18 +3421,29 @@ void naveg_dec_control(uint8_t display)
         //sets the direction
         control->scroll_dir = g_scroll_dir = 0;
 
-        // decrements the step
-        if (control->step > 2)
+        scale_window_collect(display);
+
+        // decrements the step inside the window
+        if (control->step > 0)
             control->step--;
-        //we are at the end of our list ask for more data
+        else if (g_scale_windows[display].first)
+            return;
+        //the window didn't get the previous page in time, ask for it
         else
         {
         	//request new data, a new control we be assigned after
-        	request_control_page(control, 0);
+        	request_control_page(control, 0, 0);
 
         	//since a new control is assigned we can return
         	return;
         }
+
+        step_to_value(control);
+        control_set(display, control);
+
+        // the previous page is requested while the user is still turning
+        scale_window_prefetch(display, 0);
+        return;
     }
     else if (control->properties & FLAG_CONTROL_TOGGLED)
     {
@@ -2443,9 +3461,12 @@ void naveg_dec_control(uint8_t display)
     }
     else
     {
-        // decrements the step
+        // decrements the step, accelerated moves jump several steps in a single control_set
         if (control->step > 0)
-            control->step--;
+        {
+            if (steps > control->step) control->step = 0;
+            else control->step -= steps;
+        }
         else
             return;
     }
@@ -2476,18 +3497,37 @@ void naveg_set_control(uint8_t hw_id, float value)
         control = g_foots[hw_id - ENCODERS_COUNT];
         id = hw_id - ENCODERS_COUNT;
     }
+    //expression pedal
+    else if (hw_id >= EXPRESSION0 && hw_id < (EXPRESSION0 + EXPRESSIONS_COUNT))
+    {
+        control = g_expressions[hw_id - EXPRESSION0];
+        id = hw_id - EXPRESSION0;
+    }
 
     if (control)
     {
-        control->value = value;
         if (value < control->minimum)
-            control->value = control->minimum;
+            value = control->minimum;
         if (value > control->maximum)
-            control->value = control->maximum;
+            value = control->maximum;
+
+        // the state drawn for the value stored, an echoed value is always stored
+        drawn_state_t drawn, state;
+        control_drawn_state(control, &drawn);
+
+        control->value = value;
 
         // updates the step value
-        control->step =
-            (control->value - control->minimum) / ((control->maximum - control->minimum) / control->steps);
+        if (control->decimals != FIXED_NONE)
+            control->step = control_fixed_step(control);
+        else
+            control->step = control_value_step(control, control->value);
+
+        // webgui echoes the values set on the HMI, nothing is redrawn if they look the same
+        // triggers are excluded since their led follows the footswitch state, not the value
+        control_drawn_state(control, &state);
+        if (!(control->properties & FLAG_CONTROL_TRIGGER) && memcmp(&drawn, &state, sizeof(drawn_state_t)) == 0)
+            return;
 
 
         //encoder
@@ -2570,16 +3610,7 @@ void naveg_set_control(uint8_t hw_id, float value)
                 uint16_t time_ms = (uint16_t)(convert_to_ms(control->unit, control->value) + 0.5);
 
                 // setup the led blink
-                if (time_ms > TAP_TEMPO_TIME_ON)
-                {
-                    led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), TAP_TEMPO_COLOR);
-                     led_blink(hardware_leds(control->hw_id - ENCODERS_COUNT), TAP_TEMPO_TIME_ON, time_ms - TAP_TEMPO_TIME_ON);
-                }
-                else
-                {
-                    led_set_color(hardware_leds(control->hw_id - ENCODERS_COUNT), TAP_TEMPO_COLOR);
-                    led_blink(hardware_leds(control->hw_id - ENCODERS_COUNT), time_ms / 2, time_ms / 2);
-                }
+                tap_tempo_led(control->hw_id - ENCODERS_COUNT, time_ms);
 
                 // calculates the maximum tap tempo value
                 if (g_tap_tempo[control->hw_id - ENCODERS_COUNT].state == TT_INIT)
@@ -2683,6 +3714,174 @@ void naveg_set_control(uint8_t hw_id, float value)
     }
 }
 
+uint32_t naveg_ui_state_hash(const char *uid)
+{
+    if (!g_initialized) return 0;
+
+    if (uid) g_ui_state.uid = ui_state_uid(uid);
+
+    return ui_state_hash();
+}
+
+void naveg_ui_state_snapshot(void)
+{
+    if (!g_initialized) return;
+
+    uint8_t i;
+
+    uint32_t uid = g_ui_state.uid;
+    g_ui_state.uid = 0;
+
+    struct UI_SNAPSHOT_T *snapshot = ui_snapshot_slot(uid);
+    snapshot->hash = ui_state_hash();
+    snapshot->uid = uid;
+    snapshot->used = ++g_ui_state.serial;
+    snapshot->valid = 1;
+
+    for (i = 0; i < ENCODERS_COUNT; i++)
+    {
+        struct CONTROL_RING_T *ring = &g_control_rings[i];
+
+        // the control waiting its index isn't confirmed, it's dropped
+        control_t *added = ring->added;
+        ring->added = NULL;
+        control_ring_release(i, added);
+
+        snapshot->rings[i] = *ring;
+        snapshot->rings[i].switches = 0;
+        memset(ring, 0, sizeof(*ring));
+
+        snapshot->controls[i] = g_controls[i];
+        g_controls[i] = NULL;
+        g_scale_windows[i].serial++;
+    }
+
+    for (i = 0; i < FOOTSWITCHES_COUNT; i++)
+    {
+        if (!g_foots[i]) continue;
+
+        snapshot->controls[ENCODERS_COUNT + i] = g_foots[i];
+        g_foots[i] = NULL;
+
+        if (!bank_config_check(i))
+        {
+            led_blink(hardware_leds(i), 0, 0);
+            led_set_color(hardware_leds(i), BLACK);
+        }
+    }
+
+#if EXPRESSIONS_COUNT > 0
+    for (i = 0; i < EXPRESSIONS_COUNT; i++)
+    {
+        snapshot->controls[EXPRESSION0 + i] = g_expressions[i];
+        g_expressions[i] = NULL;
+    }
+#endif
+
+    // nothing was assigned, there is no set to keep
+    snapshot->size = ui_snapshot_size(snapshot);
+    if (snapshot->size) ui_snapshot_trim(snapshot);
+    else ui_snapshot_free(snapshot);
+
+    // draws the screens without controls
+    for (i = 0; i < TOTAL_ACTUATORS; i++)
+    {
+        naveg_remove_control(i);
+    }
+}
+
+uint8_t naveg_ui_state_restore(const char *uid, uint32_t hash, char **values, uint32_t count)
+{
+    if (!g_initialized) return 0;
+
+    struct UI_SNAPSHOT_T *snapshot = ui_snapshot_find(uid ? ui_state_uid(uid) : 0, hash);
+    if (!snapshot) return 0;
+
+    uint8_t i;
+    uint32_t j;
+
+    // the set leaves the cache before its foots are added as controls sent by webgui, which drops the untagged sets
+    struct UI_SNAPSHOT_T set = *snapshot;
+    memset(snapshot, 0, sizeof(*snapshot));
+
+    // the controls left by webgui are replaced
+    for (i = 0; i < TOTAL_ACTUATORS; i++)
+    {
+        naveg_remove_control(i);
+    }
+
+    for (i = 0; i < TOTAL_ACTUATORS; i++)
+    {
+        control_t *control = set.controls[i];
+
+        if (i < ENCODERS_COUNT)
+        {
+            g_control_rings[i] = set.rings[i];
+            if (control) control_ring_show(i, control);
+        }
+        else if (control)
+        {
+            naveg_add_control(control, 1);
+        }
+    }
+
+    // the set goes back to the cache on the next pedalboard_clear
+    g_ui_state.uid = set.uid;
+
+    // values changed while webgui was away
+    for (j = 0; j + 1 < count; j += 2)
+    {
+        naveg_set_control(atoi(values[j]), atof(values[j + 1]));
+    }
+
+    return 1;
+}
+
+uint8_t naveg_set_control_table(uint8_t hw_id, char **values, uint32_t count)
+{
+    if (!g_initialized) return 0;
+
+    if (hw_id >= ENCODERS_COUNT) return 0;
+
+    control_t *control = g_controls[hw_id];
+    if (!control || control->decimals == FIXED_NONE) return 0;
+    if (count < 2 || count > NAVEG_STEP_TABLE_MAX) return 0;
+
+    int32_t *table = (int32_t *) MALLOC(sizeof(int32_t) * count);
+    if (!table) return 0;
+
+    uint32_t i;
+    for (i = 0; i < count; i++)
+    {
+        float value = atof(values[i]);
+
+        // the curve has to be inside the control range and monotonic
+        if (value < control->minimum || value > control->maximum)
+        {
+            FREE(table);
+            return 0;
+        }
+
+        table[i] = float_to_fixed(value, control->decimals);
+
+        if (i > 0 && table[i] < table[i - 1])
+        {
+            FREE(table);
+            return 0;
+        }
+    }
+
+    FREE(control->fixed_table);
+    control->fixed_table = table;
+    control->steps = count;
+    control->step = control_fixed_step(control);
+
+    if (!display_has_tool_enabled(hw_id))
+        screen_encoder(hw_id, control);
+
+    return 1;
+}
+
 float naveg_get_control(uint8_t hw_id)
 {
     if (!g_initialized) return 0.0;
@@ -2696,6 +3895,15 @@ float naveg_get_control(uint8_t hw_id)
     return 0.0;
 }
 
+// the request item is the ring of the display which sent the switch
+static void control_next_sent(void *data, menu_item_t *item)
+{
+    struct CONTROL_RING_T *ring = (struct CONTROL_RING_T *) item;
+
+    // webgui didn't answer, the controls it sends later are shown as they arrive
+    if (!data) ring->switches = 0;
+}
+
 void naveg_next_control(uint8_t display)
 {
     if (!g_initialized) return;
@@ -2713,21 +3921,65 @@ void naveg_next_control(uint8_t display)
     i += int_to_str(display, &buffer[i], 4, 0);
     buffer[i] = 0;
 
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    // the next control is already parsed, it's shown at once and webgui follows the index
+    struct CONTROL_RING_T *ring = &g_control_rings[display];
+    if (ring->count > 1 && ring->count <= NAVEG_CONTROL_RING)
+    {
+        uint8_t next = (ring->index + 1) % ring->count;
+
+        if (ring->slots[next])
+        {
+            ring->index = next;
+            ring->switches++;
+            control_ring_show(display, ring->slots[next]);
+            control_ring_trim(display, NULL);
 
-    // sends the data to GUI
-    comm_webgui_send(buffer, i);
+            comm_webgui_request(buffer, i, control_next_sent, (menu_item_t *) ring, WEBGUI_ASYNC_TIMEOUT);
+            FREE(buffer);
+            return;
+        }
+    }
 
-    // waits the pedalboards list be received
-    comm_webgui_wait_response();
+    protocol_lock(LINK_OWNER_NAVEG);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    // sends the data to GUI and waits the response, webgui sends the next control
+    comm_webgui_wait_response(comm_webgui_send(buffer, i));
+
+    protocol_unlock(LINK_OWNER_NAVEG);
 
     FREE(buffer);
 }
 
+void naveg_expression_change(uint8_t expression, uint16_t value)
+{
+    if (!g_initialized) return;
+
+    // checks the expression id, there is none without the expression input
+#if EXPRESSIONS_COUNT > 0
+    if (expression >= EXPRESSIONS_COUNT) return;
+#else
+    (void) value;
+    return;
+#endif
+
+    control_t *control = g_expressions[expression];
+    if (!control || control->steps < 2) return;
+
+    // the pedal only follows continuous controls
+    if (control->properties & (FLAG_CONTROL_ENUMERATION | FLAG_CONTROL_SCALE_POINTS | FLAG_CONTROL_REVERSE |
+                               FLAG_CONTROL_TOGGLED | FLAG_CONTROL_BYPASS | FLAG_CONTROL_TRIGGER |
+                               FLAG_CONTROL_MOMENTARY | FLAG_CONTROL_TAP_TEMPO))
+        return;
+
+    // only a new step is worth a control_set
+    int32_t step = (((int32_t) value * (control->steps - 1)) + (EXPRESSION_MAX_VALUE / 2)) / EXPRESSION_MAX_VALUE;
+    if (step == control->step) return;
+
+    control->step = step;
+    step_to_value(control);
+    control_set(expression, control);
+}
+
 void naveg_foot_change(uint8_t foot, uint8_t pressed)
 {
     if (!g_initialized) return;
@@ -2815,7 +4067,7 @@ void naveg_toggle_tool(uint8_t tool, uint8_t display)
         {
             case DISPLAY_TOOL_NAVIG:
                 // initial state to banks/pedalboards navigation
-                if (!banks_loaded) request_banks_list(2);
+                if (!banks_loaded && !request_banks_list(2)) return;
                 banks_loaded = 1;
                 tool_off(DISPLAY_TOOL_SYSTEM_SUBMENU);
                 display = 1;
@@ -2824,17 +4076,12 @@ void naveg_toggle_tool(uint8_t tool, uint8_t display)
             case DISPLAY_TOOL_TUNER:
                 display_disable_all_tools(display);
 
-                g_protocol_busy = true;
-                system_lock_comm_serial(g_protocol_busy);
-
-                // sends the data to GUI
-                comm_webgui_send(CMD_TUNER_ON, strlen(CMD_TUNER_ON));
+                protocol_lock(LINK_OWNER_NAVEG);
 
-                // waits the pedalboards list be received
-                comm_webgui_wait_response();
+                // sends the data to GUI and waits the response
+                comm_webgui_wait_response(comm_webgui_send(CMD_TUNER_ON, strlen(CMD_TUNER_ON)));
 
-                g_protocol_busy = false;
-                system_lock_comm_serial(g_protocol_busy);
+                protocol_unlock(LINK_OWNER_NAVEG);
 
                 break;
             case DISPLAY_TOOL_SYSTEM:
@@ -2880,17 +4127,12 @@ void naveg_toggle_tool(uint8_t tool, uint8_t display)
 
             case DISPLAY_TOOL_TUNER:
 
-                g_protocol_busy = true;
-                system_lock_comm_serial(g_protocol_busy);
+                protocol_lock(LINK_OWNER_NAVEG);
 
-                // sends the data to GUI
-                comm_webgui_send(CMD_TUNER_OFF, strlen(CMD_TUNER_OFF));
+                // sends the data to GUI and waits the response
+                comm_webgui_wait_response(comm_webgui_send(CMD_TUNER_OFF, strlen(CMD_TUNER_OFF)));
 
-                // waits the pedalboards list be received
-                comm_webgui_wait_response();
-
-                g_protocol_busy = false;
-                system_lock_comm_serial(g_protocol_busy);
+                protocol_unlock(LINK_OWNER_NAVEG);
 
                 tool_off(DISPLAY_TOOL_TUNER);
 
@@ -2950,6 +4192,11 @@ uint8_t naveg_is_tool_mode(uint8_t display)
     return display_has_tool_enabled(display);
 }
 
+uint32_t naveg_tools_serial(void)
+{
+    return g_tools_serial;
+}
+
 uint8_t naveg_tool_is_on(uint8_t tool)
 {
     return tool_is_on(tool);
@@ -3198,6 +4445,9 @@ void naveg_set_active_pedalboard(uint8_t pedalboard_index)
     //0th item is "back to banks list"
     uint32_t index = pedalboard_index + 1;
 
+    // a switch made on the HMI is reconciled by its load response
+    if (g_pb_load.serial != g_pb_load.confirmed_serial) return;
+
     g_current_pedalboard = index;
 
     if (g_current_bank == g_banks->selected) {
@@ -3206,6 +4456,18 @@ void naveg_set_active_pedalboard(uint8_t pedalboard_index)
     }
 }
 
+void naveg_process_responses(void)
+{
+    if (g_pb_load.answered) pb_load_answered();
+
+    footswitch_page_install();
+}
+
+int naveg_responses_pending(void)
+{
+    return (g_pb_load.answered || g_footswitch_page.received);
+}
+
 void naveg_set_pb_list_update(void)
 {
     g_pedalboards_need_update = true;
@@ -3221,7 +4483,11 @@ void naveg_update_pb_list(void)
     if (tool_is_on(DISPLAY_TOOL_NAVIG))
     {
         if (g_bp_state == PEDALBOARD_LIST) {
-            request_pedalboards(PAGE_DIR_INIT, atoi(g_banks->uids[g_banks->selected - g_banks->page_min]));
+            if (!request_pedalboards(PAGE_DIR_INIT, atoi(g_banks->uids[g_banks->selected - g_banks->page_min])))
+            {
+                g_pedalboards_need_update = false;
+                return;
+            }
 
             char *title = g_banks->names[g_banks->selected - g_banks->page_min];
             screen_bp_list(title, g_naveg_pedalboards);
@@ -3304,18 +4570,44 @@ char* naveg_get_current_pb_name(void)
 
 void naveg_set_index(uint8_t update, uint8_t display, uint8_t new_index, uint8_t new_index_count)
 {
-    static uint8_t index[ENCODERS_COUNT] = {};
-    static uint8_t index_count[ENCODERS_COUNT] = {};
+    if (display >= ENCODERS_COUNT) return;
+
+    struct CONTROL_RING_T *ring = &g_control_rings[display];
 
     if (update)
     {
-        index[display] = new_index;
-        index_count[display] = new_index_count;
+        control_t *control = ring->added;
+        ring->added = NULL;
+
+        // a new addressing set drops the controls kept from the previous one
+        if (new_index_count != ring->count) control_ring_clear(display);
+        ring->count = new_index_count;
+
+        // the index confirms a switch made on the HMI, the index shown is already ahead
+        if (ring->switches) ring->switches--;
+        else ring->index = new_index;
+
+        if (control && new_index < NAVEG_CONTROL_RING && new_index_count <= NAVEG_CONTROL_RING)
+        {
+            control_t *previous = ring->slots[new_index];
+            ring->slots[new_index] = control;
+            if (previous != control) control_ring_release(display, previous);
+
+            control_ring_trim(display, control);
+
+            // the control sent by webgui is the up to date copy of the shown one
+            if (new_index == ring->index && g_controls[display] != control)
+                control_ring_show(display, control);
+        }
+        else
+        {
+            control_ring_release(display, control);
+        }
     }
 
     if ((g_controls[display]) && !display_has_tool_enabled(display))
     {
-        screen_controls_index(display, index[display], index_count[display]);
+        screen_controls_index(display, ring->index, ring->count);
     }
 
     return;
@@ -3379,16 +4671,12 @@ void naveg_update_gain(uint8_t display_id, uint8_t update_id, float value, float
                 float_to_str(item->data.value, str_buf, sizeof(str_buf), 2);
             }
 
-            strcpy(item->name, item->desc->name);
-            uint8_t q;
-            uint8_t value_size = strlen(str_buf);
-            uint8_t name_size = strlen(item->name);
-            for (q = 0; q < (31 - name_size - value_size - 3); q++)
-            {
-                strcat(item->name, " ");
-            }
-            strcat(item->name, str_buf);
-            strcat(item->name, " dB");
+            strbuf_t name;
+            strbuf_init(&name, item->name, MAX_CHARS_MENU_NAME);
+            strbuf_append(&name, item->desc->name);
+            strbuf_fill(&name, ' ', MENU_LINE_CHARS - strlen(str_buf) - 3);
+            strbuf_append(&name, str_buf);
+            strbuf_append(&name, " dB");
         }
     }
 }
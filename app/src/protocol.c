@@ -73,7 +73,10 @@ typedef struct CMD_T {
 */
 
 static unsigned int g_command_count = 0;
-static cmd_t g_commands[COMMAND_COUNT_DUO];
+static cmd_t g_commands[COMMAND_COUNT_DUO + PROTOCOL_EXTRA_COMMANDS];
+
+// who holds the webgui link and since when, see LINK_HOLDS/LINK_SINCE
+static volatile uint32_t g_link_state;
 
 
 /*
@@ -102,6 +105,20 @@ static int is_wildcard(const char *str)
     return 0;
 }
 
+// decodes the hex image in place, the binary data is always shorter than its text
+static uint8_t *glcd_draw_decode(proto_t *proto, uint16_t *size)
+{
+    uint8_t *image = (uint8_t *) proto->list[4];
+    uint16_t len = strlen(proto->list[4]) / 2;
+
+    *size = str_to_hex(proto->list[4], image, len);
+
+    // must have at least the width and height
+    if (*size < 2) return NULL;
+
+    return image;
+}
+
 
 /*
 ************************************************************************************************************************
@@ -208,7 +225,7 @@ void protocol_parse(msg_t *msg)
 
 void protocol_add_command(const char *command, void (*callback)(proto_t *proto))
 {
-    if (g_command_count >= COMMAND_COUNT_DUO) while (1);
+    if (g_command_count >= (COMMAND_COUNT_DUO + PROTOCOL_EXTRA_COMMANDS)) while (1);
 
     char *cmd = str_duplicate(command);
     g_commands[g_command_count].command = cmd;
@@ -232,7 +249,7 @@ void protocol_response(const char *response, proto_t *proto)
     response_buffer[proto->response_size] = 0;
 }
 
-void protocol_send_response(const char *response, const uint8_t value ,proto_t *proto)
+void protocol_send_response(const char *response, const int32_t value ,proto_t *proto)
 {
     char buffer[20];
     uint8_t i = 0;
@@ -257,6 +274,55 @@ void protocol_remove_commands(void)
     }
 }
 
+// the link state is shared by tasks and read by ISRs, so it is only changed with exclusive accesses
+void protocol_lock(uint32_t owner)
+{
+    uint32_t state, since = hardware_timestamp() << 15;
+
+    do {
+        state = __LDREXW(&g_link_state);
+
+        // a hold past the count would be added to the next owner, the locks aren't balanced
+        if (LINK_HOLDS(state, owner) == LINK_HOLDS_MAX)
+        {
+            __CLREX();
+            while (1);
+        }
+
+        // the timestamp is taken by the first hold only
+        if (LINK_OWNERS(state) == 0) state = since;
+
+        state += owner;
+    } while (__STREXW(state, &g_link_state));
+}
+
+// releases one hold of the owner, the protocol task unlocks the parser even when it didn't lock it
+void protocol_unlock(uint32_t owner)
+{
+    uint32_t state;
+
+    do {
+        state = __LDREXW(&g_link_state);
+        if (LINK_HOLDS(state, owner) == 0) break;
+        state -= owner;
+
+        // the link is free, it has no timestamp
+        if (LINK_OWNERS(state) == 0) state = 0;
+    } while (__STREXW(state, &g_link_state));
+
+    __CLREX();
+}
+
+uint32_t protocol_link_state(void)
+{
+    return g_link_state;
+}
+
+uint8_t protocol_busy(void)
+{
+    return (LINK_OWNERS(g_link_state) != 0);
+}
+
 //initialize all protocol commands
 void protocol_init(void)
 {
@@ -264,15 +330,19 @@ void protocol_init(void)
     protocol_add_command(CMD_PING, cb_ping);
     protocol_add_command(CMD_SAY, cb_say);
     protocol_add_command(CMD_LED, cb_led);
+    protocol_add_command(CMD_LED_ANIMATION, cb_led_animation);
     protocol_add_command(CMD_GLCD_TEXT, cb_glcd_text);
     protocol_add_command(CMD_GLCD_DIALOG, cb_glcd_dialog);
     protocol_add_command(CMD_GLCD_DRAW, cb_glcd_draw);
+    protocol_add_command(CMD_GLCD_DRAW_RLE, cb_glcd_draw_rle);
     protocol_add_command(CMD_GUI_CONNECTED, cb_gui_connection);
     protocol_add_command(CMD_GUI_DISCONNECTED, cb_gui_connection);
     protocol_add_command(CMD_DISP_BRIGHTNESS, cb_disp_brightness);
     protocol_add_command(CMD_CONTROL_ADD, cb_control_add);
     protocol_add_command(CMD_CONTROL_REMOVE, cb_control_rm);
     protocol_add_command(CMD_CONTROL_SET, cb_control_set);
+    protocol_add_command(CMD_CONTROL_SET_MULTI, cb_control_set_multi);
+    protocol_add_command(CMD_CONTROL_TABLE, cb_control_table);
     protocol_add_command(CMD_CONTROL_GET, cb_control_get);
     protocol_add_command(CMD_DUO_CONTROL_INDEX_SET, cb_control_set_index);
     protocol_add_command(CMD_INITIAL_STATE, cb_initial_state);
@@ -283,6 +353,9 @@ void protocol_init(void)
     protocol_add_command(CMD_DUO_BOOT, cb_boot);
     protocol_add_command(CMD_MENU_ITEM_CHANGE, cb_menu_item_changed);
     protocol_add_command(CMD_PEDALBOARD_CLEAR, cb_pedalboard_clear);
+    protocol_add_command(CMD_UI_STATE, cb_ui_state);
+    protocol_add_command(CMD_UI_STATE_RESTORE, cb_ui_state_restore);
+    protocol_add_command(CMD_UI_STATE_LOAD, cb_ui_state_load);
     protocol_add_command(CMD_PEDALBOARD_NAME_SET, cb_pedalboard_name);
     protocol_add_command(CMD_PEDALBOARD_CHANGE, cb_pedalboard_change);
     protocol_add_command(CMD_SNAPSHOT_NAME_SET, cb_snapshot_name);
@@ -297,7 +370,8 @@ void protocol_init(void)
 void cb_ping(proto_t *proto)
 {
     g_ui_communication_started = 1;
-    g_protocol_busy = false;
+    // the actuators don't need to wait the ping response
+    protocol_unlock(LINK_OWNER_PARSER);
     protocol_send_response(CMD_RESPONSE, 0, proto);
 }
 
@@ -323,6 +397,36 @@ void cb_led(proto_t *proto)
     protocol_send_response(CMD_RESPONSE, 0, proto);
 }
 
+void cb_led_animation(proto_t *proto)
+{
+    uint8_t i, count;
+    led_keyframe_t frames[LED_MAX_KEYFRAMES];
+    led_t *led = hardware_leds(atoi(proto->list[1]));
+
+    // each keyframe has five arguments
+    if (!led || proto->list_count < 3 || ((proto->list_count - 3) % 5) ||
+        ((proto->list_count - 3) / 5) > LED_MAX_KEYFRAMES)
+    {
+        protocol_send_response(CMD_RESPONSE, -1, proto);
+        return;
+    }
+
+    count = (proto->list_count - 3) / 5;
+
+    for (i = 0; i < count; i++)
+    {
+        char **keyframe = &proto->list[3 + (i * 5)];
+        frames[i].color.r = atoi(keyframe[0]);
+        frames[i].color.g = atoi(keyframe[1]);
+        frames[i].color.b = atoi(keyframe[2]);
+        frames[i].fade_ms = atoi(keyframe[3]);
+        frames[i].hold_ms = atoi(keyframe[4]);
+    }
+
+    led_animate(led, frames, count, atoi(proto->list[2]));
+    protocol_send_response(CMD_RESPONSE, 0, proto);
+}
+
 void cb_glcd_text(proto_t *proto)
 {
     uint8_t glcd_id, x, y;
@@ -351,10 +455,30 @@ void cb_glcd_draw(proto_t *proto)
 
     if (glcd_id >= GLCD_COUNT) return;
 
-    uint8_t msg_buffer[WEBGUI_COMM_RX_BUFF_SIZE];
+    uint16_t size;
+    uint8_t *image = glcd_draw_decode(proto, &size);
+
+    // raw images must carry all the pages
+    if (image && size >= (2 + image[0] * ((image[1] + 7) / 8)))
+        glcd_draw_image(hardware_glcds(glcd_id), x, y, image, GLCD_BLACK);
+
+    protocol_send_response(CMD_RESPONSE, 0, proto);
+}
+
+void cb_glcd_draw_rle(proto_t *proto)
+{
+    uint8_t glcd_id, x, y;
+    glcd_id = atoi(proto->list[1]);
+    x = atoi(proto->list[2]);
+    y = atoi(proto->list[3]);
+
+    if (glcd_id >= GLCD_COUNT) return;
+
+    uint16_t size;
+    uint8_t *image = glcd_draw_decode(proto, &size);
 
-    str_to_hex(proto->list[4], msg_buffer, WEBGUI_COMM_RX_BUFF_SIZE);
-    glcd_draw_image(hardware_glcds(glcd_id), x, y, msg_buffer, GLCD_BLACK);
+    if (image)
+        glcd_draw_image_rle(hardware_glcds(glcd_id), x, y, image, size, GLCD_BLACK);
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 }
@@ -362,10 +486,11 @@ void cb_glcd_draw(proto_t *proto)
 void cb_gui_connection(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
     //clear the buffer so we dont send any messages
     comm_webgui_clear();
+    // the responses of the requests sent before won't come
+    comm_webgui_release();
 
     if (strcmp(proto->list[0], CMD_GUI_CONNECTED) == 0)
         naveg_ui_connection(UI_CONNECTED);
@@ -373,8 +498,7 @@ void cb_gui_connection(proto_t *proto)
         naveg_ui_connection(UI_DISCONNECTED);
 
     //we are done supposedly closing the menu, we can unlock the actuators
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 }
@@ -389,15 +513,13 @@ void cb_disp_brightness(proto_t *proto)
 void cb_control_add(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     control_t *control = data_parse_control(proto->list);
 
     naveg_add_control(control, 1);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
     protocol_send_response(CMD_RESPONSE, 0, proto);
 }
 
@@ -423,14 +545,47 @@ void cb_control_rm(proto_t *proto)
 void cb_control_set(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     naveg_set_control(atoi(proto->list[1]), atof(proto->list[2]));
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
+}
+
+void cb_control_set_multi(proto_t *proto)
+{
+    uint32_t i;
+
+    // each control has two arguments
+    if ((proto->list_count - 1) % 2)
+    {
+        protocol_send_response(CMD_RESPONSE, -1, proto);
+        return;
+    }
+
+    //lock actuators once for the whole burst
+    protocol_lock(LINK_OWNER_CALLBACK);
+
+    for (i = 1; i < proto->list_count; i += 2)
+    {
+        naveg_set_control(atoi(proto->list[i]), atof(proto->list[i + 1]));
+    }
+
+    protocol_send_response(CMD_RESPONSE, 0, proto);
+
+    protocol_unlock(LINK_OWNER_CALLBACK);
+}
+
+void cb_control_table(proto_t *proto)
+{
+    //lock actuators
+    protocol_lock(LINK_OWNER_CALLBACK);
+
+    uint8_t ok = naveg_set_control_table(atoi(proto->list[1]), &proto->list[2], proto->list_count - 2);
+    protocol_send_response(CMD_RESPONSE, ok ? 0 : -1, proto);
+
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_control_get(proto_t *proto)
@@ -448,15 +603,13 @@ void cb_control_get(proto_t *proto)
 void cb_control_set_index(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     //index_set <updatevalues> <encoder hardware_id> <control index> <index_count>
     naveg_set_index(1, atoi(proto->list[1]), atoi(proto->list[2]), atoi(proto->list[3]));
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_initial_state(proto_t *proto)
@@ -468,8 +621,7 @@ void cb_initial_state(proto_t *proto)
 
 void cb_bank_config(proto_t *proto)
 {
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     bank_config_t bank_func;
     bank_func.hw_id = atoi(proto->list[1]);
@@ -477,8 +629,7 @@ void cb_bank_config(proto_t *proto)
     naveg_bank_config(&bank_func);
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_tuner(proto_t *proto)
@@ -523,8 +674,7 @@ void cb_boot(proto_t *proto)
 
 void cb_menu_item_changed(proto_t *proto)
 {
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     naveg_menu_item_changed_cb(atoi(proto->list[1]), atoi(proto->list[2]));
     
@@ -540,40 +690,66 @@ void cb_menu_item_changed(proto_t *proto)
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_pedalboard_clear(proto_t *proto)
 {
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
-    //clear controls
-    uint8_t i;
-    for (i = 0; i < TOTAL_ACTUATORS; i++)
-    {
-        naveg_remove_control(i);
-    }
+    //clear controls, they're kept until webgui restores them or sends new ones
+    naveg_ui_state_snapshot();
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
+}
+
+void cb_ui_state(proto_t *proto)
+{
+    protocol_lock(LINK_OWNER_CALLBACK);
+
+    char resp[32];
+    uint32_t i = copy_command(resp, CMD_RESPONSE);
+
+    resp[i++] = '0';
+    resp[i++] = ' ';
+    int_to_str(naveg_ui_state_hash(proto->list_count > 1 ? proto->list[1] : NULL), &resp[i], sizeof(resp) - i, 0);
+    protocol_response(resp, proto);
+
+    protocol_unlock(LINK_OWNER_CALLBACK);
+}
+
+void cb_ui_state_restore(proto_t *proto)
+{
+    protocol_lock(LINK_OWNER_CALLBACK);
+
+    uint8_t ok = naveg_ui_state_restore(NULL, atoi(proto->list[1]), &proto->list[2], proto->list_count - 2);
+    protocol_send_response(CMD_RESPONSE, ok ? 0 : -1, proto);
+
+    protocol_unlock(LINK_OWNER_CALLBACK);
+}
+
+void cb_ui_state_load(proto_t *proto)
+{
+    protocol_lock(LINK_OWNER_CALLBACK);
+
+    uint8_t ok = naveg_ui_state_restore(proto->list[1], atoi(proto->list[2]), &proto->list[3], proto->list_count - 3);
+    protocol_send_response(CMD_RESPONSE, ok ? 0 : -1, proto);
+
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_pedalboard_name(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     screen_pb_name(&proto->list[1], 1);
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
 
 void cb_pedalboard_change(proto_t *proto)
@@ -588,13 +764,11 @@ void cb_pedalboard_change(proto_t *proto)
 void cb_snapshot_name(proto_t *proto)
 {
     //lock actuators
-    g_protocol_busy = true;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_lock(LINK_OWNER_CALLBACK);
 
     screen_ss_name(&proto->list[2], 1);
 
     protocol_send_response(CMD_RESPONSE, 0, proto);
 
-    g_protocol_busy = false;
-    system_lock_comm_serial(g_protocol_busy);
+    protocol_unlock(LINK_OWNER_CALLBACK);
 }
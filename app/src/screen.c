@@ -55,6 +55,8 @@ enum {BANKS_LIST, PEDALBOARD_LIST};
 */
 
 static tuner_t g_tuner = {0, NULL, 0, 1};
+static listbox_view_t g_bp_list_view;
+static uint32_t g_bp_list_serial, g_bp_list_revision;
 
 /*
 ************************************************************************************************************************
@@ -166,10 +168,18 @@ void screen_encoder(uint8_t display_id, control_t *control)
     {
         static char *labels_list[10];
 
-        uint8_t i;
-        for (i = 0; i < control->scale_points_count; i++)
+        // paginated controls keep more scale points than labels, only the ones around the step are listed
+        uint8_t i, first = 0, count = control->scale_points_count;
+        if (count > 10)
         {
-            labels_list[i] = control->scale_points[i]->label;
+            if (control->step > 5) first = control->step - 5;
+            if (first > count - 10) first = count - 10;
+            count = 10;
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            labels_list[i] = control->scale_points[first + i]->label;
         }
 
         listbox_t list;
@@ -180,8 +190,8 @@ void screen_encoder(uint8_t display_id, control_t *control)
         list.color = GLCD_BLACK;
         list.font = Terminal3x5;
         list.font_highlight = Terminal5x7;
-        list.selected = control->step;
-        list.count = control->scale_points_count;
+        list.selected = control->step - first;
+        list.count = count;
         list.list = labels_list;
         list.line_space = 1;
         list.line_top_margin = 1;
@@ -212,7 +222,12 @@ void screen_encoder(uint8_t display_id, control_t *control)
         bar.steps = control->steps - 1;
 
         char str_bfr[15] = {0};
-        if ((control->value > 99.9) || (control->properties & FLAG_CONTROL_INTEGER))
+        if (control->decimals != FIXED_NONE)
+        {
+            uint8_t precision = ((control->value > 99.9f) || (control->properties & FLAG_CONTROL_INTEGER)) ? 0 : 2;
+            fixed_to_str(control->fixed_value, control->decimals, str_bfr, sizeof(str_bfr), precision);
+        }
+        else if ((control->value > 99.9) || (control->properties & FLAG_CONTROL_INTEGER))
         {
             int_to_str(control->value, str_bfr, sizeof(str_bfr), 0);
         }
@@ -584,6 +599,10 @@ void screen_bp_list(const char *title, bp_list_t *list)
 
     glcd_t *display = hardware_glcds(1);
 
+    // the list is only partially redrawn if nothing else touched the display since the last draw
+    if (!list || list->serial != g_bp_list_serial || glcd_revision(display) != g_bp_list_revision)
+        g_bp_list_view.valid = 0;
+
     // clears the title
     glcd_rect_fill(display, 0, 0, DISPLAY_WIDTH, 9, GLCD_WHITE);
 
@@ -607,7 +626,6 @@ void screen_bp_list(const char *title, bp_list_t *list)
     // draws the list
     if (list)
     {
-        uint8_t count = strarr_length(list->names);
         list_box.x = 0;
         list_box.y = 11;
         list_box.width = 128;
@@ -615,14 +633,15 @@ void screen_bp_list(const char *title, bp_list_t *list)
         list_box.color = GLCD_BLACK;
         list_box.hover = list->hover - list->page_min;
         list_box.selected = list->selected - list->page_min;
-        list_box.count = count;
+        list_box.count = list->count;
         list_box.list = list->names;
         list_box.font = Terminal3x5;
         list_box.line_space = 2;
         list_box.line_top_margin = 1;
         list_box.line_bottom_margin = 1;
         list_box.text_left_margin = 2;
-        widget_listbox(display, &list_box);
+        widget_listbox_view(display, &list_box, &g_bp_list_view);
+        g_bp_list_serial = list->serial;
     }
     else
     {
@@ -643,6 +662,8 @@ void screen_bp_list(const char *title, bp_list_t *list)
             widget_textbox(display, &message);
         }
     }
+
+    g_bp_list_revision = glcd_revision(display);
 }
 
 void screen_system_menu(menu_item_t *item)
@@ -820,8 +841,8 @@ void screen_tuner_input(uint8_t input)
         widget_tuner(hardware_glcds(1), &g_tuner);
 }
 
-void screen_image(uint8_t display, const uint8_t *image)
+void screen_image(uint8_t display, const uint8_t *image, uint16_t size)
 {
     glcd_t *display_img = hardware_glcds(display);
-    glcd_draw_image(display_img, 0, 0, image, GLCD_BLACK);
+    glcd_draw_image_rle(display_img, 0, 0, image, size, GLCD_BLACK);
 }
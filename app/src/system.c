@@ -12,6 +12,7 @@
 #include "hardware.h"
 #include "actuator.h"
 #include "comm.h"
+#include "protocol.h"
 #include "cli.h"
 #include "screen.h"
 #include "glcd_widget.h"
@@ -80,7 +81,6 @@ char *option_disabled = "[ ]";
 ************************************************************************************************************************
 */
 
-static uint8_t g_comm_protocol_bussy = 0;
 float g_gains_volumes[5] = {};
 uint8_t g_q_bypass = 0;
 uint8_t g_bypass[4] = {};
@@ -140,23 +140,19 @@ void add_chars_to_menu_name(menu_item_t *item, char *chars_to_add)
         if ((!chars_to_add)||(!item)) return; 
 
         //always copy the clean name
-        strcpy(item->name, item->desc->name);
-        uint8_t value_size = strlen(chars_to_add);
-        uint8_t name_size = strlen(item->name);
-        uint8_t q;
-        //add spaces until so we allign the chars_to_add to the left
-        for (q = 0; q < (MENU_LINE_CHARS - name_size - value_size); q++)
-        {
-            strcat(item->name, " ");
-        }
+        strbuf_t name;
+        strbuf_init(&name, item->name, MAX_CHARS_MENU_NAME);
+        strbuf_append(&name, item->desc->name);
 
-        strcat(item->name, chars_to_add);
+        //add spaces until so we allign the chars_to_add to the left
+        strbuf_fill(&name, ' ', MENU_LINE_CHARS - strlen(chars_to_add));
+        strbuf_append(&name, chars_to_add);
 }
 
 //TODO CHECK IF WE CAN USE DYNAMIC MEMORY HERE
 static void set_item_value(char *command, uint16_t value)
 {
-    if (g_comm_protocol_bussy) return;
+    if (protocol_busy()) return;
 
     uint8_t i;
     char buffer[50];
@@ -174,16 +170,13 @@ static void set_item_value(char *command, uint16_t value)
     }
     buffer[i] = 0;
 
-    // sets the response callback
-    comm_webgui_set_response_cb(NULL, NULL);
-
-    // sends the data to GUI
+    // sends the data to GUI, the response is only consumed
     comm_webgui_send(buffer, i);
 }
 
 static void set_menu_item_value(uint16_t menu_id, uint16_t value)
 {
-    if (g_comm_protocol_bussy) return;
+    if (protocol_busy()) return;
 
     uint8_t i = 0;
     char buffer[50];
@@ -202,10 +195,7 @@ static void set_menu_item_value(uint16_t menu_id, uint16_t value)
 
     buffer[i++] = 0;
 
-    // sets the response callback
-    comm_webgui_set_response_cb(NULL, NULL);
-
-    // sends the data to GUI
+    // sends the data to GUI, the response is only consumed
     comm_webgui_send(buffer, i);
 }
 
@@ -297,16 +287,12 @@ static void volume(menu_item_t *item, int event, const char *source, float min,
         float_to_str(item->data.value, str_bfr, 8, 2);
     }
 
-    strcpy(item->name, item->desc->name);
-    uint8_t q;
-    uint8_t value_size = strlen(str_bfr);
-    uint8_t name_size = strlen(item->name);
-    for (q = 0; q < (31 - name_size - value_size - 3); q++)
-    {
-        strcat(item->name, " ");
-    }
-    strcat(item->name, str_bfr);
-    strcat(item->name, " dB");
+    strbuf_t name;
+    strbuf_init(&name, item->name, MAX_CHARS_MENU_NAME);
+    strbuf_append(&name, item->desc->name);
+    strbuf_fill(&name, ' ', MENU_LINE_CHARS - strlen(str_bfr) - 3);
+    strbuf_append(&name, str_bfr);
+    strbuf_append(&name, " dB");
 
     //if stereo link is on we need to update the other menu item as well
     if ((((event == MENU_EV_UP) || (event == MENU_EV_DOWN)) && (dir ? g_sl_out : g_sl_in))&& (item->desc->id != HP_VOLUME))
@@ -325,11 +311,6 @@ static void volume(menu_item_t *item, int event, const char *source, float min,
 *           GLOBAL FUNCTIONS
 ************************************************************************************************************************
 */
-void system_lock_comm_serial(bool busy)
-{
-    g_comm_protocol_bussy = busy;
-}
-
 uint8_t system_get_current_profile(void)
 {
     return g_current_profile;
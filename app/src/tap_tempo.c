@@ -0,0 +1,210 @@
+/*
+************************************************************************************************************************
+*           INCLUDE FILES
+************************************************************************************************************************
+*/
+
+#include "tap_tempo.h"
+#include "hardware.h"
+
+
+/*
+************************************************************************************************************************
+*           LOCAL DEFINES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           LOCAL CONSTANTS
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           LOCAL DATA TYPES
+************************************************************************************************************************
+*/
+
+typedef struct TAP_T {
+    uint32_t press;
+    uint32_t taps[TAP_TEMPO_TAPS];
+    uint8_t count;
+
+    // least squares estimation of the taps
+    uint32_t period, beat;
+} tap_t;
+
+
+/*
+************************************************************************************************************************
+*           LOCAL MACROS
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           LOCAL GLOBAL VARIABLES
+************************************************************************************************************************
+*/
+
+static tap_t g_taps[FOOTSWITCHES_COUNT];
+
+
+/*
+************************************************************************************************************************
+*           LOCAL FUNCTION PROTOTYPES
+************************************************************************************************************************
+*/
+
+
+/*
+************************************************************************************************************************
+*           LOCAL CONFIGURATION ERRORS
+************************************************************************************************************************
+*/
+
+#if TAP_TEMPO_TAPS < 2
+#error "TAP_TEMPO_TAPS must be at least 2"
+#endif
+
+
+/*
+************************************************************************************************************************
+*           LOCAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+// median of the intervals between the taps
+static uint32_t median_interval(tap_t *tap)
+{
+    uint32_t intervals[TAP_TEMPO_TAPS - 1], interval;
+    uint8_t i, j, count = tap->count - 1;
+
+    for (i = 0; i < count; i++)
+    {
+        interval = tap->taps[i + 1] - tap->taps[i];
+
+        // insertion sort, there are only a few intervals
+        for (j = i; j > 0 && intervals[j - 1] > interval; j--) intervals[j] = intervals[j - 1];
+        intervals[j] = interval;
+    }
+
+    if (count & 1) return intervals[count / 2];
+    return (intervals[(count / 2) - 1] + intervals[count / 2]) / 2;
+}
+
+// fits the taps to a line, the slope is the period and the line gives the time of the last beat
+static void estimate(tap_t *tap)
+{
+    int64_t sum_x = 0, sum_xy = 0, sum_xx = 0, sum_y = 0;
+    int64_t n = tap->count;
+    uint8_t i;
+
+    for (i = 0; i < tap->count; i++)
+    {
+        // times relative to the first tap, they fit in 32 bits
+        int64_t y = tap->taps[i] - tap->taps[0];
+
+        sum_x += i;
+        sum_xx += i * i;
+        sum_y += y;
+        sum_xy += i * y;
+    }
+
+    int64_t period = ((n * sum_xy) - (sum_x * sum_y)) / ((n * sum_xx) - (sum_x * sum_x));
+    int64_t offset = (sum_y - (period * sum_x)) / n;
+
+    tap->period = period;
+    tap->beat = tap->taps[0] + (uint32_t) (offset + (period * (n - 1)));
+}
+
+
+/*
+************************************************************************************************************************
+*           GLOBAL FUNCTIONS
+************************************************************************************************************************
+*/
+
+void tap_tempo_press(uint8_t foot, uint32_t time_us)
+{
+    if (foot >= FOOTSWITCHES_COUNT) return;
+
+    g_taps[foot].press = time_us;
+}
+
+void tap_tempo_reset(uint8_t foot)
+{
+    if (foot >= FOOTSWITCHES_COUNT) return;
+
+    g_taps[foot].count = 0;
+    g_taps[foot].period = 0;
+}
+
+uint32_t tap_tempo_tap(uint8_t foot, uint32_t max_us)
+{
+    if (foot >= FOOTSWITCHES_COUNT) return 0;
+
+    tap_t *tap = &g_taps[foot];
+    uint32_t interval, median;
+
+    if (tap->count > 0)
+    {
+        interval = tap->press - tap->taps[tap->count - 1];
+
+        // a tap after the timeout starts a new sequence, a tap just over it is still accepted
+        if (interval > max_us + (TAP_TEMPO_MAXVAL_OVERFLOW * 1000))
+        {
+            tap->count = 0;
+        }
+        // a tap away from the tempo tapped until now starts a new tempo from the previous tap
+        else if (tap->count > 1)
+        {
+            median = median_interval(tap);
+            if ((interval > median ? interval - median : median - interval) > (TAP_TEMPO_TAP_HYSTERESIS * 1000))
+            {
+                tap->taps[0] = tap->taps[tap->count - 1];
+                tap->count = 1;
+            }
+        }
+    }
+
+    // the oldest tap is dropped when the sequence is full
+    if (tap->count == TAP_TEMPO_TAPS)
+    {
+        uint8_t i;
+        for (i = 1; i < TAP_TEMPO_TAPS; i++) tap->taps[i - 1] = tap->taps[i];
+        tap->count--;
+    }
+
+    tap->taps[tap->count++] = tap->press;
+
+    if (tap->count < 2)
+    {
+        tap->period = 0;
+        return 0;
+    }
+
+    estimate(tap);
+
+    if (tap->period > max_us) tap->period = max_us;
+
+    return tap->period;
+}
+
+uint32_t tap_tempo_phase(uint8_t foot, uint32_t period_us)
+{
+    if (foot >= FOOTSWITCHES_COUNT || period_us == 0) return 0;
+
+    tap_t *tap = &g_taps[foot];
+    if (!tap->period) return 0;
+
+    // the fitted beat can be slightly ahead of the last tap
+    int32_t elapsed = hardware_timestamp_us() - tap->beat;
+    if (elapsed < 0) return (period_us - ((uint32_t) -elapsed % period_us)) % period_us;
+
+    return (uint32_t) elapsed % period_us;
+}
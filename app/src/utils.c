@@ -26,6 +26,15 @@
 ************************************************************************************************************************
 */
 
+static const uint32_t g_pow10[FIXED_DECIMALS_MAX + 1] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+static const float g_pow10_inv[FIXED_DECIMALS_MAX + 1] = {1.0f, 0.1f, 0.01f, 0.001f, 0.0001f, 0.00001f, 0.000001f};
+
+// 2^(2^-(n+1)) in Q2.30
+static const uint32_t g_exp2_frac[16] = {
+    0x5A82799A, 0x4C1BF829, 0x45CAE0F2, 0x42D561B4, 0x4166C34C, 0x40B268FA, 0x4058F6A8, 0x402C6BE9,
+    0x4016321B, 0x400B1818, 0x40058BCE, 0x4002C5D8, 0x400162E8, 0x4000B173, 0x400058B9, 0x40002C5D
+};
+
 
 /*
 ************************************************************************************************************************
@@ -282,65 +291,149 @@ uint32_t int_to_str(int32_t num, char *string, uint32_t string_size, uint8_t zer
 
 uint32_t float_to_str(float num, char *string, uint32_t string_size, uint8_t precision)
 {
-    double intp, fracp;
-    char *str = string;
-
     if (!string) return 0;
 
-    // TODO: check Nan and Inf
+    if (precision > FIXED_DECIMALS_MAX) precision = FIXED_DECIMALS_MAX;
 
-    // splits integer and fractional parts
-    fracp = modf(num, &intp);
+    // the number is scaled once and formatted as integer, modf would need double precision
+    float scaled = num * (float) g_pow10[precision];
 
-    // convert to absolute value
-    if (intp < 0.0) intp = -intp;
-    if (fracp < 0.0) fracp = -fracp;
+    // numbers too large to be scaled lose the fractional part, the ones past the int32 range saturate
+    if (!(scaled < 2147483520.0f && scaled > -2147483520.0f))
+    {
+        if (num != num) num = 0.0f;
+        else if (num > 2147483520.0f) num = 2147483520.0f;
+        else if (num < -2147483520.0f) num = -2147483520.0f;
 
-    // insert minus if negative number
-    if (num < 0.0)
+        return int_to_str((int32_t) num, string, string_size, 0);
+    }
+
+    return fixed_to_str(float_to_fixed(num, precision), precision, string, string_size, precision);
+}
+
+uint8_t fixed_decimals(float minimum, float maximum)
+{
+    int8_t decimals;
+
+    if (minimum < 0.0f) minimum = -minimum;
+    if (maximum < 0.0f) maximum = -maximum;
+    if (maximum < minimum) maximum = minimum;
+
+    // keeps one bit of headroom for the range span
+    for (decimals = FIXED_DECIMALS_MAX; decimals >= 0; decimals--)
     {
-        *str = '-';
-        str++;
+        if ((maximum * (float) g_pow10[decimals]) < 1073741824.0f) return decimals;
     }
 
-    // convert the integer part to string
-    uint32_t int_len;
-    int_len = int_to_str((int32_t)intp, str, string_size, 0);
+    return FIXED_NONE;
+}
+
+int32_t float_to_fixed(float num, uint8_t decimals)
+{
+    float scaled = num * (float) g_pow10[decimals];
+    return (int32_t) (scaled < 0.0f ? scaled - 0.5f : scaled + 0.5f);
+}
 
-    // checks if convertion fail
+float fixed_to_float(int32_t num, uint8_t decimals)
+{
+    return (float) num * g_pow10_inv[decimals];
+}
+
+uint32_t fixed_to_str(int32_t num, uint8_t decimals, char *string, uint32_t string_size, uint8_t precision)
+{
+    uint32_t magnitude, digits, len = 0;
+
+    if (!string || string_size < 2) return 0;
+
+    magnitude = (num < 0) ? -num : num;
+
+    // rounds the decimal places which aren't shown
+    digits = decimals;
+    if (precision < decimals)
+    {
+        uint32_t div = g_pow10[decimals - precision];
+        magnitude = (magnitude + (div / 2)) / div;
+        digits = precision;
+    }
+
+    // insert minus if negative number
+    if (num < 0 && magnitude)
+    {
+        string[len++] = '-';
+        string_size--;
+    }
+
+    // integer part
+    uint32_t int_len = int_to_str(magnitude / g_pow10[digits], &string[len], string_size, 0);
     if (int_len == 0)
     {
         *string = 0;
         return 0;
     }
+    len += int_len;
+    string_size -= int_len;
 
-    // adds one to avoid lost the leading zeros
-    fracp += 1.0;
+    if (precision == 0) return len;
 
-    // calculates the precision
-    while (precision--)
+    // fractional part, padded with zeros when the precision is larger than the decimals
+    if (string_size <= (uint32_t) precision + 1)
     {
-        fracp *= 10;
+        *string = 0;
+        return 0;
     }
 
-    // add 0.5 to round
-    fracp += 0.5;
+    string[len++] = '.';
+    if (digits) len += int_to_str(magnitude % g_pow10[digits], &string[len], string_size - 1, digits);
+    while (digits++ < precision) string[len++] = '0';
+    string[len] = 0;
 
-    // convert the fractional part
-    uint32_t frac_len;
-    frac_len = int_to_str((int32_t)fracp, &str[int_len], string_size - int_len, 0);
+    return len;
+}
+
+int32_t fixed_log2(uint32_t num)
+{
+    if (num == 0) return INT32_MIN;
+
+    uint8_t msb = 31 - __builtin_clz(num);
+    int32_t result = msb << 16;
 
-    // checks if convertion fail
-    if (frac_len == 0)
+    // mantissa in Q1.31, each squaring gives the next fractional bit
+    uint32_t mantissa = num << (31 - msb);
+    uint32_t bit;
+    for (bit = (1 << 15); bit; bit >>= 1)
     {
-        *string = 0;
-        return 0;
+        uint64_t square = ((uint64_t) mantissa * mantissa) >> 31;
+        if (square >= (1ULL << 32))
+        {
+            square >>= 1;
+            result |= bit;
+        }
+        mantissa = square;
+    }
+
+    return result;
+}
+
+uint32_t fixed_exp2(int32_t num)
+{
+    int32_t int_part = num >> 16;
+    uint32_t frac_part = num & 0xFFFF;
+    uint32_t result = (1 << 30);
+    uint8_t i;
+
+    // 2^frac in Q2.30
+    for (i = 0; i < 16; i++)
+    {
+        if (frac_part & (0x8000 >> i))
+            result = ((uint64_t) result * g_exp2_frac[i]) >> 30;
     }
 
-    // inserts the dot covering the extra one added
-    str[int_len] = '.';
+    if (int_part >= 32) return UINT32_MAX;
+    if (int_part >= 30) return result << (int_part - 30);
+    if (int_part <= -2) return 0;
 
-    return (int_len + frac_len);
+    uint8_t shift = 30 - int_part;
+    return (result + (1 << (shift - 1))) >> shift;
 }
 
 char *str_duplicate(const char *str)
@@ -353,6 +446,39 @@ char *str_duplicate(const char *str)
     return copy;
 }
 
+void strbuf_init(strbuf_t *sb, char *buffer, uint32_t size)
+{
+    sb->buffer = buffer;
+    sb->size = size;
+    sb->length = 0;
+
+    if (size > 0) buffer[0] = 0;
+}
+
+uint32_t strbuf_append(strbuf_t *sb, const char *str)
+{
+    if (!str || sb->size == 0) return sb->length;
+
+    while (*str && sb->length < (sb->size - 1))
+        sb->buffer[sb->length++] = *str++;
+
+    sb->buffer[sb->length] = 0;
+
+    return sb->length;
+}
+
+uint32_t strbuf_fill(strbuf_t *sb, char c, uint32_t length)
+{
+    if (sb->size == 0) return sb->length;
+
+    while (sb->length < length && sb->length < (sb->size - 1))
+        sb->buffer[sb->length++] = c;
+
+    sb->buffer[sb->length] = 0;
+
+    return sb->length;
+}
+
 // handy function to make a copy of a C-string array (char**)
 char** str_array_duplicate(char** list, uint16_t count)
 {
@@ -450,22 +576,22 @@ float convert_to_ms(const char *unit_from, float value)
 
     if (strcmp(unit, "bpm") == 0)
     {
-        return (60000.0 / value);
+        return (60000.0f / value);
     }
     else if (strcmp(unit, "hz") == 0)
     {
-        return (1000.0 / value);
+        return (1000.0f / value);
     }
     else if (strcmp(unit, "s") == 0)
     {
-        return (value * 1000.0);
+        return (value * 1000.0f);
     }
     else if (strcmp(unit, "ms") == 0)
     {
         return value;
     }
 
-    return 0.0;
+    return 0.0f;
 }
 
 float convert_from_ms(const char *unit_to, float value)
@@ -483,22 +609,22 @@ float convert_from_ms(const char *unit_to, float value)
 
     if (strcmp(unit, "bpm") == 0)
     {
-        return (60000.0 / value);
+        return (60000.0f / value);
     }
     else if (strcmp(unit, "hz") == 0)
     {
-        return (1000.0 / value);
+        return (1000.0f / value);
     }
     else if (strcmp(unit, "s") == 0)
     {
-        return (value / 1000.0);
+        return (value / 1000.0f);
     }
     else if (strcmp(unit, "ms") == 0)
     {
         return value;
     }
 
-    return 0.0;
+    return 0.0f;
 }
 
 ringbuff_t *ringbuff_create(uint32_t buffer_size)
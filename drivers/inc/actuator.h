@@ -21,7 +21,7 @@
 
 // Actuators types
 typedef enum {
-    BUTTON, ROTARY_ENCODER
+    BUTTON, ROTARY_ENCODER, EXPRESSION_PEDAL
 } actuator_type_t;
 
 // Actuators properties
@@ -40,6 +40,8 @@ typedef enum {
 #define EV_ENCODER_TURNED_CW    0x20
 #define EV_ENCODER_TURNED_ACW   0x40
 #define EV_ALL_ENCODER_EVENTS   0xEF
+#define EV_EXPRESSION_CHANGED   0x80
+#define EV_ALL_EXPRESSION_EVENTS 0x80
 
 
 /*
@@ -58,6 +60,7 @@ typedef enum {
 // These configurations have been moved to config.h
 #if 0
 #define READ_PIN(port, pin)
+#define READ_PINS(port)
 #define CONFIG_PIN_INPUT(port, pin)
 #endif
 
@@ -73,6 +76,14 @@ typedef enum {
 // Encoders configuration
 #define ENCODER_RESOLUTION          24
 
+// Expression pedals configuration
+// the samples are 16 bits, the filter is a one pole low-pass with coefficient 2^-SHIFT
+#define EXPRESSION_FILTER_SHIFT     2
+// bits of the reported value and hysteresis around it (in samples units)
+#define EXPRESSION_RESOLUTION       10
+#define EXPRESSION_HYSTERESIS       48
+#define EXPRESSION_MAX_VALUE        ((1 << EXPRESSION_RESOLUTION) - 1)
+
 
 /*
 *********************************************************************************************************
@@ -85,8 +96,7 @@ typedef enum {
     actuator_type_t type;               \
     uint8_t status, control;            \
     uint8_t events_flags;               \
-    void (*event) (void *actuator);     \
-    uint8_t debounce;
+    void (*event) (void *actuator);
 
 typedef struct BUTTON_T {
     actuators_common_fields
@@ -95,15 +105,29 @@ typedef struct BUTTON_T {
     uint16_t hold_time, hold_time_counter;
 } button_t;
 
+// the encoder starts with the button layout, so its switch is handled as a button
 typedef struct ENCODER_T {
     actuators_common_fields
 
-    uint8_t port, pin, port_chA, pin_chA, port_chB, pin_chB;
+    uint8_t port, pin;
     uint16_t hold_time, hold_time_counter;
+    uint8_t port_chA, pin_chA, port_chB, pin_chB;
     uint8_t steps, state;
     int8_t counter;
+    // velocity estimation: time of the last detent and smoothed interval between detents (ms)
+    uint16_t last_detent, interval;
+    uint8_t acceleration;
 } encoder_t;
 
+typedef struct EXPRESSION_T {
+    actuators_common_fields
+
+    uint8_t channel;
+    // low-pass accumulator (samples << EXPRESSION_FILTER_SHIFT) and reported value
+    uint32_t filter;
+    uint16_t value;
+} expression_t;
+
 
 /*
 *********************************************************************************************************
@@ -126,6 +150,7 @@ typedef struct ENCODER_T {
 #define ENCODER_TURNED(status)      ((status) & EV_ENCODER_TURNED)
 #define ENCODER_TURNED_CW(status)   ((status) & EV_ENCODER_TURNED_CW)
 #define ENCODER_TURNED_ACW(status)  ((status) & EV_ENCODER_TURNED_ACW)
+#define EXPRESSION_CHANGED(status)  ((status) & EV_EXPRESSION_CHANGED)
 
 
 /*
@@ -141,6 +166,10 @@ void actuator_enable_event(void *actuator, uint8_t events_flags);
 void actuator_set_event(void *actuator, void (*event)(void *actuator));
 uint8_t actuator_get_status(void *actuator);
 void actuators_clock(void);
+// quadrature decoding of the encoders which have a channel in pins (bitmask of the changed pins)
+void actuators_pins_changed(uint8_t port, uint32_t pins);
+// filters a new sample of the expression pedals connected to the ADC channel
+void actuators_analog_sample(uint8_t channel, uint16_t sample);
 
 
 /*
@@ -91,8 +91,12 @@
 #define glcd_rect_fill      FUNC_WRAP(rect_fill)
 #define glcd_rect_invert    FUNC_WRAP(rect_invert)
 #define glcd_draw_image     FUNC_WRAP(draw_image)
+#define glcd_draw_image_rle FUNC_WRAP(draw_image_rle)
 #define glcd_text           FUNC_WRAP(text)
+#define glcd_vscroll        FUNC_WRAP(vscroll)
+#define glcd_revision       FUNC_WRAP(revision)
 #define glcd_update         FUNC_WRAP(update)
+#define glcd_need_update    FUNC_WRAP(need_update)
 
 
 /*
@@ -33,6 +33,15 @@
 #define KS0108_WHITE_BLACK      3
 #define KS0108_CHESS            4
 
+// compressed image format (draw_image_rle)
+// header: width, height; then page ordered data as a sequence of opcodes:
+//   0x00..0x7F: literal, the next (op + 1) bytes are copied
+//   0x80..0xBF: repeat, the next byte is copied (op & 0x3F) + 1 times
+//   0xC0..0xFF: skip, (op & 0x3F) + 1 bytes keep the current buffer content
+#define KS0108_RLE_OP_MASK      0xC0
+#define KS0108_RLE_REPEAT       0x80
+#define KS0108_RLE_SKIP         0xC0
+
 // backlight
 #define KS0108_BACKLIGHT_ON     1
 #define KS0108_BACKLIGHT_OFF    0
@@ -78,6 +87,7 @@ typedef struct KS0108_T {
     uint8_t rst_port, rst_pin;
     uint8_t backlight_port, backlight_pin;
 
+    uint32_t revision;
     uint8_t buffer[DISPLAY_HEIGHT/8][DISPLAY_WIDTH];
 } ks0108_t;
 
@@ -113,8 +123,14 @@ void ks0108_rect(ks0108_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t he
 void ks0108_rect_fill(ks0108_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color);
 void ks0108_rect_invert(ks0108_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 void ks0108_draw_image(ks0108_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint8_t color);
+void ks0108_draw_image_rle(ks0108_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint16_t size, uint8_t color);
 void ks0108_text(ks0108_t *disp, uint8_t x, uint8_t y, const char *text, const uint8_t *font, uint8_t color);
+// shifts the rows of the region (rows > 0 moves down), the exposed rows are filled with color
+void ks0108_vscroll(ks0108_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t rows, uint8_t color);
+// returns a counter incremented on each buffer change
+uint32_t ks0108_revision(ks0108_t *disp);
 void ks0108_update(ks0108_t *disp);
+uint8_t ks0108_need_update(ks0108_t *disp);
 
 
 /*
@@ -44,8 +44,12 @@
 // defines the max number of led_t variables (objects) that will be created
 #define MAX_LEDS                LEDS_COUNT // LEDS_COUNT is defined in config.h
 
-// defines the leds pwm clock in Hertz
-#define LEDS_PWM_CLOCK_Hz       200000
+// defines the duration in microseconds of the least significant bit of the colors
+// a full modulation frame lasts 255 times this value
+#define LEDS_BCM_UNIT_us        10
+
+// defines the max number of keyframes of an animation
+#define LED_MAX_KEYFRAMES       8
 
 // defines if LED_TURN_ON_WITH_ZERO or LED_TURN_ON_WITH_ONE
 #define LED_TURN_ON_WITH_ZERO
@@ -56,6 +60,8 @@
 #define CONFIG_PIN_OUTPUT(port, pin)
 #define SET_PIN(port, pin)
 #define CLR_PIN(port, pin)
+#define SET_PINS(port, mask)
+#define CLR_PINS(port, mask)
 #endif
 
 
@@ -75,11 +81,29 @@ typedef struct LED_PINS_T {
     uint8_t portB, pinB;
 } led_pins_t;
 
+// fades to the color in fade_ms and keeps it for hold_ms
+typedef struct LED_KEYFRAME_T {
+    color_t color;
+    uint16_t fade_ms, hold_ms;
+} led_keyframe_t;
+
+typedef struct LED_ANIMATION_T {
+    led_keyframe_t frames[LED_MAX_KEYFRAMES];
+    // fixed point (16.16) color increments per ms of each keyframe, the first keyframe
+    // uses 'first' in the first play and 'steps[0]' (fade from the last keyframe) when repeating
+    int32_t steps[LED_MAX_KEYFRAMES][3], first[3];
+    int32_t level[3];
+    uint8_t count, index, repeat, played;
+    uint16_t counter;
+} led_animation_t;
+
 typedef struct LED_T {
     uint8_t control;
     led_pins_t pins;
     color_t color;
     uint16_t time_on, time_off, counter;
+    volatile uint8_t animating;
+    led_animation_t animation;
 } led_t;
 
 
@@ -92,6 +116,16 @@ typedef struct LED_T {
 void led_init(led_t *led, const led_pins_t pins);
 void led_set_color(led_t *led, const color_t color);
 void led_blink(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms);
+// starts the blink as if it had started elapsed_ms ago
+void led_blink_phase(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms, uint32_t elapsed_ms);
+// plays the keyframes starting from the current color, repeat = 0 loops forever
+// the animation is stopped by led_set_color
+void led_animate(led_t *led, const led_keyframe_t *frames, uint8_t count, uint8_t repeat);
+void led_fade(led_t *led, const color_t color, uint16_t time_ms);
+// outputs the next modulation bit and returns its weight, the caller must wait
+// (weight * LEDS_BCM_UNIT_us) before calling it again
+uint32_t leds_modulation(void);
+// blink timing, must be called each 1ms
 void leds_clock(void);
 
 
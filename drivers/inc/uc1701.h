@@ -43,6 +43,15 @@
 #define UC1701_WHITE_BLACK    3
 #define UC1701_CHESS          4
 
+// compressed image format (draw_image_rle)
+// header: width, height; then page ordered data as a sequence of opcodes:
+//   0x00..0x7F: literal, the next (op + 1) bytes are copied
+//   0x80..0xBF: repeat, the next byte is copied (op & 0x3F) + 1 times
+//   0xC0..0xFF: skip, (op & 0x3F) + 1 bytes keep the current buffer content
+#define UC1701_RLE_OP_MASK      0xC0
+#define UC1701_RLE_REPEAT       0x80
+#define UC1701_RLE_SKIP         0xC0
+
 // display status
 #define NEED_UPDATE     1
 #define UPDATING        2
@@ -84,6 +93,7 @@ typedef struct UC1701_T {
     uint8_t backlight_port, backlight_pin;
 
     uint8_t status;
+    uint32_t revision;
     uint8_t buffer[DISPLAY_HEIGHT/8][DISPLAY_WIDTH];
 } uc1701_t;
 
@@ -112,6 +122,7 @@ void uc1701_init(uc1701_t *disp);
 void uc1701_backlight(uc1701_t *disp, uint8_t state);
 void uc1701_clear(uc1701_t *disp, uint8_t color);
 void uc1701_update(uc1701_t *disp);
+uint8_t uc1701_need_update(uc1701_t *disp);
 void uc1701_set_pixel(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t color);
 void uc1701_hline(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t color);
 void uc1701_vline(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t height, uint8_t color);
@@ -120,7 +131,12 @@ void uc1701_rect(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t he
 void uc1701_rect_fill(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color);
 void uc1701_rect_invert(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 void uc1701_draw_image(uc1701_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint8_t color);
+void uc1701_draw_image_rle(uc1701_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint16_t size, uint8_t color);
 void uc1701_text(uc1701_t *disp, uint8_t x, uint8_t y, const char *text, const uint8_t *font, uint8_t color);
+// shifts the rows of the region (rows > 0 moves down), the exposed rows are filled with color
+void uc1701_vscroll(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t rows, uint8_t color);
+// returns a counter incremented on each buffer change
+uint32_t uc1701_revision(uc1701_t *disp);
 
 
 /*
@@ -1,6 +1,7 @@
 
 /*
  * Note: Debounce algorithm by Jack J. Ganssle - "A Guide to Debouncing"
+ * The counters are kept as vertical counters so all switches of a port are debounced at once
  */
 
 /*
@@ -27,14 +28,21 @@
 
 #define TRIGGER_FLAGS \
     (EV_BUTTON_CLICKED | EV_BUTTON_HELD | \
-     EV_ENCODER_TURNED | EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW)
+     EV_ENCODER_TURNED | EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW | \
+     EV_EXPRESSION_CHANGED)
 
 #define TOGGLE_FLAGS \
     (EV_BUTTON_PRESSED | EV_BUTTON_RELEASED)
 
+// debounce counters are bit planes, one bit of each switch per plane
+#define DEBOUNCE_PLANES     7
+#define MAX_DEBOUNCE_PORTS  3
+#define NO_ACTUATOR         0xFF
+
 #define BUTTON_ON_FLAG      0x01
 #define ENCODER_CHA_FLAG    0x02
 #define ENCODER_INIT_FLAG   0x04
+#define EXPRESSION_INIT_FLAG 0x08
 #define CLICK_CANCEL_FLAG   0x10
 
 
@@ -51,6 +59,15 @@
 *********************************************************************************************************
 */
 
+typedef struct DEBOUNCE_PORT_T {
+    uint8_t port;
+    uint32_t mask, invert;
+    uint32_t state, holding;
+    uint32_t counter[DEBOUNCE_PLANES];
+    uint32_t press[DEBOUNCE_PLANES], release[DEBOUNCE_PLANES];
+    uint8_t actuators[32];
+} debounce_port_t;
+
 
 /*
 *********************************************************************************************************
@@ -62,6 +79,8 @@
 #define CLR_FLAG(status,flag)       (status &= ~flag)
 #define ACTUATOR_TYPE(act)          (((button_t *)(act))->type)
 #define ABS(num)                    (num >= 0 ? num : -num)
+#define EDGE_INT_PORT(port)         ((port) == 0 || (port) == 2)
+#define ENCODER_HAS_EDGE_INT(enc)   (EDGE_INT_PORT((enc)->port_chA) && EDGE_INT_PORT((enc)->port_chB))
 
 /*
 *********************************************************************************************************
@@ -71,7 +90,11 @@
 
 static void *g_actuators_pointers[MAX_ACTUATORS];
 static uint8_t g_actuators_count = 0;
-static uint8_t acceleration = 1;
+static volatile uint16_t g_clock;
+static debounce_port_t g_debounce_ports[MAX_DEBOUNCE_PORTS];
+static uint8_t g_debounce_ports_count;
+static encoder_t *g_polled_encoders[MAX_ACTUATORS];
+static uint8_t g_polled_encoders_count;
 
 /*
 *********************************************************************************************************
@@ -80,6 +103,12 @@ static uint8_t acceleration = 1;
 */
 
 static void event(void *actuator, uint8_t flags);
+static void encoder_velocity(encoder_t *encoder);
+static void encoder_step(encoder_t *encoder);
+static void debounce_add(void *actuator, uint8_t port, uint8_t pin, uint8_t activated, uint16_t press, uint16_t release);
+static uint32_t debounce_port(debounce_port_t *deb);
+static void switch_changed(button_t *button, uint8_t pressed);
+static uint8_t switch_hold(button_t *button);
 
 
 /*
@@ -88,6 +117,11 @@ static void event(void *actuator, uint8_t flags);
 *********************************************************************************************************
 */
 
+#if (BUTTON_RELEASE_DEBOUNCE / CLOCK_PERIOD) >= (1 << DEBOUNCE_PLANES) || \
+    (ENCODER_RELEASE_DEBOUNCE / CLOCK_PERIOD) >= (1 << DEBOUNCE_PLANES)
+#error "Debounce times don't fit in the debounce counters, increase DEBOUNCE_PLANES"
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -103,6 +137,7 @@ static void event(void *actuator, uint8_t flags)
 
     switch (ACTUATOR_TYPE(actuator))
     {
+        case EXPRESSION_PEDAL:
         case BUTTON:
             if (button->event && (button->events_flags & flags))
             {
@@ -126,6 +161,231 @@ static void event(void *actuator, uint8_t flags)
 }
 
 
+static void encoder_velocity(encoder_t *encoder)
+{
+    uint16_t elapsed = g_clock - encoder->last_detent;
+    uint32_t ratio;
+
+    encoder->last_detent = g_clock;
+
+    // a pause restarts the estimation, otherwise the interval is smoothed (alpha = 1/4)
+    if (elapsed >= ENCODER_ACCEL_SLOW_TIME || encoder->interval >= ENCODER_ACCEL_SLOW_TIME)
+        encoder->interval = elapsed;
+    else
+        encoder->interval = ((encoder->interval * 3) + elapsed) / 4;
+
+    if (encoder->interval >= ENCODER_ACCEL_SLOW_TIME)
+    {
+        encoder->acceleration = 1;
+        return;
+    }
+
+    // (slow time / interval)^2, with 2 fractional bits on the ratio
+    ratio = (ENCODER_ACCEL_SLOW_TIME * 4) / (encoder->interval ? encoder->interval : 1);
+    ratio = (ratio * ratio) / 16;
+
+    if (ratio < 1) ratio = 1;
+    if (ratio > ENCODER_ACCEL_MAX) ratio = ENCODER_ACCEL_MAX;
+    encoder->acceleration = ratio;
+}
+
+static void encoder_step(encoder_t *encoder)
+{
+    // encoder algorithm from PaulStoffregen
+    // https://github.com/PaulStoffregen/Encoder
+    uint8_t seq = encoder->state & 3;
+
+    seq |= READ_PIN(encoder->port_chA, encoder->pin_chA) ? 4 : 0;
+    seq |= READ_PIN(encoder->port_chB, encoder->pin_chB) ? 8 : 0;
+
+    switch (seq)
+    {
+        // these ones are sent quite often during normal operation
+        case 0: case 5: case 10: case 15:
+            break;
+
+        // 1 step up
+        case 1: case 7: case 8: case 14:
+            if (encoder->counter > 0) // this fixes inverting direction
+                encoder->counter = 0;
+            encoder->counter--;
+            break;
+
+        // 1 step down
+        case 2: case 4: case 11: case 13:
+            if (encoder->counter < 0) // this fixes inverting direction
+                encoder->counter = 0;
+            encoder->counter++;
+            break;
+
+        // 2 steps up
+        case 3: case 12:
+            encoder->counter -= 2;
+            break;
+
+        // 2 steps down
+        case 6: case 9:
+            encoder->counter += 2;
+            break;
+
+        // default should never trigger (because math)
+        default:
+            return;
+    }
+
+    encoder->state = (seq >> 2);
+
+    // checks the steps
+    if (ABS(encoder->counter) >= encoder->steps)
+    {
+        encoder_velocity(encoder);
+
+        // update flags
+        CLR_FLAG(encoder->status, EV_ENCODER_TURNED_CW);
+        CLR_FLAG(encoder->status, EV_ENCODER_TURNED_ACW);
+        SET_FLAG(encoder->status, EV_ENCODER_TURNED);
+
+        // set the direction flag
+        if (encoder->counter > 0)
+            SET_FLAG(encoder->status, EV_ENCODER_TURNED_CW);
+        else
+            SET_FLAG(encoder->status, EV_ENCODER_TURNED_ACW);
+
+        event(encoder, EV_ENCODER_TURNED | EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW);
+
+        encoder->counter = 0;
+    }
+}
+
+
+static void debounce_add(void *actuator, uint8_t port, uint8_t pin, uint8_t activated, uint16_t press, uint16_t release)
+{
+    debounce_port_t *deb;
+    uint8_t i, plane;
+
+    for (i = 0; i < g_debounce_ports_count; i++)
+    {
+        if (g_debounce_ports[i].port == port) break;
+    }
+
+    if (i == g_debounce_ports_count)
+    {
+        if (i >= MAX_DEBOUNCE_PORTS) return;
+
+        deb = &g_debounce_ports[g_debounce_ports_count++];
+        deb->port = port;
+        for (plane = 0; plane < 32; plane++) deb->actuators[plane] = NO_ACTUATOR;
+    }
+
+    deb = &g_debounce_ports[i];
+
+    for (i = 0; i < g_actuators_count; i++)
+    {
+        if (g_actuators_pointers[i] == actuator) break;
+    }
+
+    deb->actuators[pin] = i;
+    deb->mask |= (1 << pin);
+    if (activated == 0) deb->invert |= (1 << pin);
+
+    // reload values of the counters, the switch starts released
+    press /= CLOCK_PERIOD;
+    release /= CLOCK_PERIOD;
+    for (plane = 0; plane < DEBOUNCE_PLANES; plane++)
+    {
+        if (press & (1 << plane))
+        {
+            deb->press[plane] |= (1 << pin);
+            deb->counter[plane] |= (1 << pin);
+        }
+        if (release & (1 << plane)) deb->release[plane] |= (1 << pin);
+    }
+}
+
+// debounces all switches of the port at once, returns the switches which changed state
+static uint32_t debounce_port(debounce_port_t *deb)
+{
+    uint32_t active, diff, borrow, reload, counter, running = 0;
+    uint8_t plane;
+
+    active = (READ_PINS(deb->port) ^ deb->invert) & deb->mask;
+    diff = active ^ deb->state;
+
+    // stable switches reload the debounce time of their state, the others count down
+    borrow = diff;
+    for (plane = 0; plane < DEBOUNCE_PLANES; plane++)
+    {
+        reload = (deb->state & deb->release[plane]) | (~deb->state & deb->press[plane]);
+        counter = (deb->counter[plane] & diff) | (reload & ~diff);
+        deb->counter[plane] = counter ^ borrow;
+        borrow &= ~counter;
+        running |= deb->counter[plane];
+    }
+
+    // debounce OK
+    diff &= ~running;
+    deb->state ^= diff;
+
+    // reload debounce counter of the switches which changed, with the debounce time of their new state
+    for (plane = 0; plane < DEBOUNCE_PLANES; plane++)
+    {
+        reload = (deb->state & deb->release[plane]) | (~deb->state & deb->press[plane]);
+        deb->counter[plane] = (deb->counter[plane] & ~diff) | (reload & diff);
+    }
+
+    return diff;
+}
+
+static void switch_changed(button_t *button, uint8_t pressed)
+{
+    if (pressed)
+    {
+        // update control and status flags
+        SET_FLAG(button->control, BUTTON_ON_FLAG);
+        CLR_FLAG(button->status, EV_BUTTON_RELEASED);
+        SET_FLAG(button->status, EV_BUTTON_PRESSED);
+
+        // reload hold time counter
+        button->hold_time_counter = button->hold_time / CLOCK_PERIOD;
+
+        event(button, EV_BUTTON_PRESSED);
+    }
+    else
+    {
+        // update control and status flags
+        CLR_FLAG(button->control, BUTTON_ON_FLAG);
+        CLR_FLAG(button->status, EV_BUTTON_PRESSED);
+        SET_FLAG(button->status, EV_BUTTON_RELEASED);
+
+        // check if must set click flag
+        if (!(button->control & CLICK_CANCEL_FLAG))
+        {
+            SET_FLAG(button->status, EV_BUTTON_CLICKED);
+        }
+
+        CLR_FLAG(button->control, CLICK_CANCEL_FLAG);
+
+        event(button, EV_BUTTON_RELEASED | EV_BUTTON_CLICKED);
+    }
+}
+
+// counts the hold time of a pressed switch, returns zero when there is nothing left to count
+static uint8_t switch_hold(button_t *button)
+{
+    if (button->hold_time_counter == 0) return 0;
+
+    button->hold_time_counter--;
+    if (button->hold_time_counter > 0) return 1;
+
+    SET_FLAG(button->status, EV_BUTTON_HELD);
+    SET_FLAG(button->control, CLICK_CANCEL_FLAG);
+
+    event(button, EV_BUTTON_HELD);
+
+    return 0;
+}
+
+
 /*
 *********************************************************************************************************
 *   GLOBAL FUNCTIONS
@@ -136,6 +396,7 @@ void actuator_create(actuator_type_t type, uint8_t id, void *actuator)
 {
     button_t *button = (button_t *) actuator;
     encoder_t *encoder = (encoder_t *) actuator;
+    expression_t *expression = (expression_t *) actuator;
 
     switch (type)
     {
@@ -146,7 +407,6 @@ void actuator_create(actuator_type_t type, uint8_t id, void *actuator)
             button->events_flags = 0;
             button->hold_time = 0;
             button->hold_time_counter = 0;
-            button->debounce = 0;
             button->control = 0;
             button->status = 0;
             break;
@@ -158,11 +418,25 @@ void actuator_create(actuator_type_t type, uint8_t id, void *actuator)
             encoder->events_flags = 0;
             encoder->hold_time = 0;
             encoder->hold_time_counter = 0;
-            encoder->debounce = 0;
             encoder->control = 0;
             encoder->status = 0;
             encoder->steps = 0;
             encoder->counter = 0;
+            encoder->last_detent = 0;
+            encoder->interval = ENCODER_ACCEL_SLOW_TIME;
+            encoder->acceleration = 1;
+            break;
+
+        case EXPRESSION_PEDAL:
+            expression->id = id;
+            expression->type = type;
+            expression->event = 0;
+            expression->events_flags = 0;
+            expression->control = 0;
+            expression->status = 0;
+            expression->channel = 0;
+            expression->filter = 0;
+            expression->value = 0;
             break;
     }
 
@@ -183,6 +457,8 @@ void actuator_set_pins(void *actuator, const uint8_t *pins)
             button->port = pins[0];
             button->pin = pins[1];
             CONFIG_PIN_INPUT(button->port, button->pin);
+            debounce_add(actuator, button->port, button->pin, BUTTON_ACTIVATED,
+                         BUTTON_PRESS_DEBOUNCE, BUTTON_RELEASE_DEBOUNCE);
             break;
 
         case ROTARY_ENCODER:
@@ -195,6 +471,16 @@ void actuator_set_pins(void *actuator, const uint8_t *pins)
             encoder->pin_chB = pins[5];
             CONFIG_PIN_INPUT(encoder->port_chA, encoder->pin_chA);
             CONFIG_PIN_INPUT(encoder->port_chB, encoder->pin_chB);
+            debounce_add(actuator, encoder->port, encoder->pin, ENCODER_ACTIVATED,
+                         ENCODER_PRESS_DEBOUNCE, ENCODER_RELEASE_DEBOUNCE);
+
+            // channels without edge interrupts are sampled on each clock
+            if (!ENCODER_HAS_EDGE_INT(encoder)) g_polled_encoders[g_polled_encoders_count++] = encoder;
+            break;
+
+        case EXPRESSION_PEDAL:
+            // pins: {PORT, PIN, ADC_FUNC, ADC_CHANNEL}, the analog function is selected by the hardware setup
+            ((expression_t *) actuator)->channel = pins[3];
             break;
     }
 }
@@ -226,6 +512,9 @@ void actuator_set_prop(void *actuator, actuator_prop_t prop, uint16_t value)
                 encoder->steps = value;
             }
             break;
+
+        case EXPRESSION_PEDAL:
+            break;
     }
 }
 
@@ -234,6 +523,7 @@ void actuator_enable_event(void *actuator, uint8_t events_flags)
 {
     switch (ACTUATOR_TYPE(actuator))
     {
+        case EXPRESSION_PEDAL:
         case BUTTON:
             ((button_t *)actuator)->events_flags = events_flags;
             break;
@@ -249,6 +539,7 @@ void actuator_set_event(void *actuator, void (*event)(void *actuator))
 {
     switch (ACTUATOR_TYPE(actuator))
     {
+        case EXPRESSION_PEDAL:
         case BUTTON:
             ((button_t *)actuator)->event = event;
             break;
@@ -268,6 +559,7 @@ uint8_t actuator_get_status(void *actuator)
 
     switch (ACTUATOR_TYPE(actuator))
     {
+        case EXPRESSION_PEDAL:
         case BUTTON:
             status = button->status;
             CLR_FLAG(button->status, TRIGGER_FLAGS);
@@ -285,273 +577,104 @@ uint8_t actuator_get_status(void *actuator)
 
 void actuators_clock(void)
 {
+    debounce_port_t *deb;
     button_t *button;
+    uint32_t changed, pending, pin_mask;
+    uint8_t i, pin;
+
+    // timestamp of the encoders detents
+    g_clock += CLOCK_PERIOD;
+
+    for (i = 0; i < g_debounce_ports_count; i++)
+    {
+        deb = &g_debounce_ports[i];
+        changed = debounce_port(deb);
+
+        // only the switches which changed state or are counting the hold time need attention
+        pending = changed | deb->holding;
+        while (pending)
+        {
+            pin = __builtin_ctz(pending);
+            pin_mask = (1 << pin);
+            pending &= ~pin_mask;
+
+            button = (button_t *) g_actuators_pointers[deb->actuators[pin]];
+
+            if (changed & pin_mask)
+            {
+                switch_changed(button, deb->state & pin_mask);
+
+                if ((deb->state & pin_mask) && button->hold_time_counter > 0) deb->holding |= pin_mask;
+                else deb->holding &= ~pin_mask;
+            }
+            else if (!switch_hold(button))
+            {
+                deb->holding &= ~pin_mask;
+            }
+        }
+    }
+
+    for (i = 0; i < g_polled_encoders_count; i++)
+    {
+        encoder_step(g_polled_encoders[i]);
+    }
+}
+
+
+void actuators_pins_changed(uint8_t port, uint32_t pins)
+{
     encoder_t *encoder;
-    uint8_t i, button_on;
+    uint8_t i;
 
     for (i = 0; i < g_actuators_count; i++)
     {
-        button = (button_t *) g_actuators_pointers[i];
         encoder = (encoder_t *) g_actuators_pointers[i];
+        if (ACTUATOR_TYPE(encoder) != ROTARY_ENCODER) continue;
 
-        switch (ACTUATOR_TYPE(g_actuators_pointers[i]))
+        if ((encoder->port_chA == port && (pins & (1 << encoder->pin_chA))) ||
+            (encoder->port_chB == port && (pins & (1 << encoder->pin_chB))))
         {
-            case BUTTON:
-                if (READ_PIN(button->port, button->pin) == BUTTON_ACTIVATED) button_on = BUTTON_ON_FLAG;
-                else button_on = 0;
-
-                // button on same state
-                if (button_on == (button->control & BUTTON_ON_FLAG))
-                {
-                    // button pressed
-                    if (button_on)
-                    {
-                        // reset debounce counter
-                        button->debounce =  BUTTON_RELEASE_DEBOUNCE / CLOCK_PERIOD;
-
-                        // button hold
-                        if (button->hold_time_counter > 0)
-                        {
-                            button->hold_time_counter--;
-                            if (button->hold_time_counter == 0)
-                            {
-                                SET_FLAG(button->status, EV_BUTTON_HELD);
-                                SET_FLAG(button->control, CLICK_CANCEL_FLAG);
-
-                                event(button, EV_BUTTON_HELD);
-                            }
-                        }
-                    }
-                    // button released
-                    else
-                    {
-                        // reset debounce counter
-                        button->debounce = BUTTON_PRESS_DEBOUNCE / CLOCK_PERIOD;
-
-                        // reload hold time counter
-                        button->hold_time_counter = button->hold_time / CLOCK_PERIOD;
-                    }
-                }
-                // button state change
-                else
-                {
-                    button->debounce--;
-                    if (button->debounce == 0) // debounce OK
-                    {
-                        // update control flags
-                        CLR_FLAG(button->control, BUTTON_ON_FLAG);
-                        button->control |= button_on;
-
-                        // button pressed
-                        if (button_on)
-                        {
-                            // update status flags
-                            CLR_FLAG(button->status, EV_BUTTON_RELEASED);
-                            SET_FLAG(button->status, EV_BUTTON_PRESSED);
-
-                            event(button, EV_BUTTON_PRESSED);
-
-                            // reload debounce counter
-                            button->debounce = BUTTON_RELEASE_DEBOUNCE / CLOCK_PERIOD;
-                        }
-                        // button released
-                        else
-                        {
-                            // update status flags
-                            CLR_FLAG(button->status, EV_BUTTON_PRESSED);
-                            SET_FLAG(button->status, EV_BUTTON_RELEASED);
-
-                            // check if must set click flag
-                            if (!(button->control & CLICK_CANCEL_FLAG))
-                            {
-                                SET_FLAG(button->status, EV_BUTTON_CLICKED);
-                            }
-
-                            CLR_FLAG(button->control, CLICK_CANCEL_FLAG);
-
-                            event(button, EV_BUTTON_RELEASED | EV_BUTTON_CLICKED);
-
-                            // reload debounce counter
-                            button->debounce = BUTTON_PRESS_DEBOUNCE / CLOCK_PERIOD;
-                        }
-                    }
-                }
-                break;
-
-            case ROTARY_ENCODER:
-                // --- button processing ---
-
-                // read button pin
-                if (READ_PIN(encoder->port, encoder->pin) == ENCODER_ACTIVATED) button_on = BUTTON_ON_FLAG;
-                else button_on = 0;
-
-                // button on same state
-                if (button_on == (encoder->control & BUTTON_ON_FLAG))
-                {
-                    // button pressed
-                    if (button_on)
-                    {
-                        // reset debounce counter
-                        encoder->debounce =  ENCODER_RELEASE_DEBOUNCE / CLOCK_PERIOD;
-
-                        // button hold
-                        if (encoder->hold_time_counter > 0)
-                        {
-                            encoder->hold_time_counter--;
-                            if (encoder->hold_time_counter == 0)
-                            {
-                                SET_FLAG(encoder->status, EV_BUTTON_HELD);
-                                SET_FLAG(encoder->control, CLICK_CANCEL_FLAG);
-
-                                event(button, EV_BUTTON_HELD);
-                            }
-                        }
-                    }
-                    // button released
-                    else
-                    {
-                        // reset debounce counter
-                        encoder->debounce = ENCODER_PRESS_DEBOUNCE / CLOCK_PERIOD;
-
-                        // reload hold time counter
-                        encoder->hold_time_counter = encoder->hold_time / CLOCK_PERIOD;
-                    }
-                }
-                // button state change
-                else
-                {
-                    encoder->debounce--;
-                    if (encoder->debounce == 0) // debounce OK
-                    {
-                        // update control flags
-                        CLR_FLAG(encoder->control, BUTTON_ON_FLAG);
-                        encoder->control |= button_on;
-
-                        // button pressed
-                        if (button_on)
-                        {
-                            // update status flags
-                            CLR_FLAG(encoder->status, EV_BUTTON_RELEASED);
-                            SET_FLAG(encoder->status, EV_BUTTON_PRESSED);
-
-                            event(button, EV_BUTTON_PRESSED);
-
-                            // reload debounce counter
-                            encoder->debounce = ENCODER_RELEASE_DEBOUNCE / CLOCK_PERIOD;
-                        }
-                        // button released
-                        else
-                        {
-                            // update status flags
-                            CLR_FLAG(encoder->status, EV_BUTTON_PRESSED);
-                            SET_FLAG(encoder->status, EV_BUTTON_RELEASED);
-
-                            // check if must set click flag
-                            if (!(encoder->control & CLICK_CANCEL_FLAG))
-                            {
-                                SET_FLAG(encoder->status, EV_BUTTON_CLICKED);
-                            }
-
-                            CLR_FLAG(encoder->control, CLICK_CANCEL_FLAG);
-
-                            event(button, EV_BUTTON_RELEASED | EV_BUTTON_CLICKED);
-
-                            // reload debounce counter
-                            encoder->debounce = ENCODER_PRESS_DEBOUNCE / CLOCK_PERIOD;
-                        }
-                    }
-                }
-                // --- rotary processing ---
-                // encoder algorithm from PaulStoffregen
-                // https://github.com/PaulStoffregen/Encoder
-                static uint8_t acceleration_count = 0;
-                static uint8_t firsttick = 0;
-
-                uint8_t seq = encoder->state & 3;
-
-                seq |= READ_PIN(encoder->port_chA, encoder->pin_chA) ? 4 : 0;
-                seq |= READ_PIN(encoder->port_chB, encoder->pin_chB) ? 8 : 0;
-
-                switch (seq)
-                {
-                    // these ones are sent quite often during normal operation
-                    case 0: case 5: case 10: case 15:
-                        break;
-
-                    // 1 step up
-                    case 1: case 7: case 8: case 14:
-                        if (encoder->counter > 0) // this fixes inverting direction
-                            encoder->counter = 0;
-                        encoder->counter--;
-                        break;
-
-                    // 1 step down
-                    case 2: case 4: case 11: case 13:
-                        if (encoder->counter < 0) // this fixes inverting direction
-                            encoder->counter = 0;
-                        encoder->counter++;
-                        break;
-
-                    // 2 steps up
-                    case 3: case 12:
-                        encoder->counter -= 2;
-                        break;
-
-                    // 2 steps down
-                    case 6: case 9:
-                        encoder->counter += 2;
-                        break;
-
-                    // default should never trigger (because math)
-                    default:
-                        continue;
-                }
-
-                encoder->state = (seq >> 2);
-
-                 if (firsttick)
-                     acceleration_count++;
-
-                // checks the steps
-                if (ABS(encoder->counter) >= encoder->steps)
-                {
-                    static uint8_t ticks_count = 0;
-                    firsttick = 1;
-                    if (acceleration_count < 100)
-                    {
-                        ticks_count++;
-                        if (ticks_count > ENCODER_ACCEL_STEP_3)
-                            acceleration = 7;
-                        else if (ticks_count > ENCODER_ACCEL_STEP_2)
-                            acceleration = 5;
-                        else if (ticks_count > ENCODER_ACCEL_STEP_1)
-                            acceleration = 3;
-                        else
-                            acceleration = 1;
-                    }
-                    else
-                    {
-                        acceleration_count = 0;
-                        firsttick = 0;
-                        ticks_count = 0;
-                        acceleration = 1;
-                    }
-
-                    // update flags
-                    CLR_FLAG(encoder->status, EV_ENCODER_TURNED_CW);
-                    CLR_FLAG(encoder->status, EV_ENCODER_TURNED_ACW);
-                    SET_FLAG(encoder->status, EV_ENCODER_TURNED);
-
-                    // set the direction flag
-                    if (encoder->counter > 0)
-                        SET_FLAG(encoder->status, EV_ENCODER_TURNED_CW);
-                    else
-                        SET_FLAG(encoder->status, EV_ENCODER_TURNED_ACW);
-
-                    event(encoder, EV_ENCODER_TURNED | EV_ENCODER_TURNED_CW | EV_ENCODER_TURNED_ACW);
-
-                    encoder->counter = 0;
-                }
+            encoder_step(encoder);
         }
     }
 }
+
+
+void actuators_analog_sample(uint8_t channel, uint16_t sample)
+{
+    expression_t *expression;
+    uint32_t filtered, low, high;
+    uint8_t i;
+
+    for (i = 0; i < g_actuators_count; i++)
+    {
+        expression = (expression_t *) g_actuators_pointers[i];
+        if (ACTUATOR_TYPE(expression) != EXPRESSION_PEDAL || expression->channel != channel) continue;
+
+        // the first sample sets the initial position without generating an event
+        if (!(expression->control & EXPRESSION_INIT_FLAG))
+        {
+            SET_FLAG(expression->control, EXPRESSION_INIT_FLAG);
+            expression->filter = (uint32_t) sample << EXPRESSION_FILTER_SHIFT;
+            expression->value = sample >> (16 - EXPRESSION_RESOLUTION);
+            continue;
+        }
+
+        // low-pass
+        expression->filter -= (expression->filter >> EXPRESSION_FILTER_SHIFT);
+        expression->filter += sample;
+        filtered = expression->filter >> EXPRESSION_FILTER_SHIFT;
+
+        // the reported value only changes when the filtered sample leaves its range plus the hysteresis
+        low = (uint32_t) expression->value << (16 - EXPRESSION_RESOLUTION);
+        high = low + (1 << (16 - EXPRESSION_RESOLUTION)) - 1 + EXPRESSION_HYSTERESIS;
+        low = (low > EXPRESSION_HYSTERESIS) ? low - EXPRESSION_HYSTERESIS : 0;
+        if (filtered >= low && filtered <= high) continue;
+
+        expression->value = filtered >> (16 - EXPRESSION_RESOLUTION);
+        if (expression->value > EXPRESSION_MAX_VALUE) expression->value = EXPRESSION_MAX_VALUE;
+
+        SET_FLAG(expression->status, EV_EXPRESSION_CHANGED);
+        event(expression, EV_EXPRESSION_CHANGED);
+    }
+}
@@ -88,7 +88,7 @@ enum {SET_PIXEL, CLEAR, HLINE, VLINE, LINE, RECT, RECT_FILL, RECT_INVERT, DRAW_I
 
 // buffer macros
 #define READ_BUFFER(disp,x,y)           disp->buffer[(y/8)][x]
-#define WRITE_BUFFER(disp,x,y,data)     disp->buffer[(y/8)][x] = (data)
+#define WRITE_BUFFER(disp,x,y,data)     (disp->buffer[(y/8)][x] = (data), disp->revision++)
 
 // backlight macros
 #if defined KS0108_BACKLIGHT_TURN_ON_WITH_ONE
@@ -548,6 +548,101 @@ void ks0108_draw_image(ks0108_t *disp, uint8_t x, uint8_t y, const uint8_t *imag
     }
 }
 
+void ks0108_draw_image_rle(ks0108_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint16_t size, uint8_t color)
+{
+    uint8_t width, height, clip_width, clip_height, op, count, data = 0;
+    uint16_t pos, total, col, row;
+    const uint8_t *end = image + size;
+
+    if (size < 2) return;
+
+    width = (uint8_t) *image++;
+    height = (uint8_t) *image++;
+
+    // the position and size may come from webgui, the image is clipped to the display
+    if (width == 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+    clip_width = ((x + width) > DISPLAY_WIDTH) ? (DISPLAY_WIDTH - x) : width;
+    clip_height = ((y + height) > DISPLAY_HEIGHT) ? (DISPLAY_HEIGHT - y) : height;
+
+    total = width * ((height + 7) / 8);
+
+    // the data is decoded straight into the display buffer, a truncated image stops where its data ends
+    for (pos = 0; pos < total && image < end;)
+    {
+        op = *image++;
+
+        if ((op & KS0108_RLE_OP_MASK) == KS0108_RLE_SKIP)
+        {
+            pos += (op & ~KS0108_RLE_OP_MASK) + 1;
+            continue;
+        }
+
+        if (op & KS0108_RLE_REPEAT)
+        {
+            if (image >= end) return;
+            count = (op & ~KS0108_RLE_OP_MASK) + 1;
+            data = *image++;
+        }
+        else
+        {
+            count = op + 1;
+        }
+
+        for (; count > 0 && pos < total; count--, pos++)
+        {
+            if (!(op & KS0108_RLE_REPEAT))
+            {
+                if (image >= end) return;
+                data = *image++;
+            }
+
+            // the bytes out of the display are decoded but not written
+            col = pos % width;
+            row = (pos / width) * 8;
+            if (col < clip_width && row < clip_height)
+            {
+                WRITE_BUFFER(disp, x + col, y + row, (color == KS0108_WHITE) ? (uint8_t) ~data : data);
+            }
+        }
+    }
+}
+
+void ks0108_vscroll(ks0108_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t rows, uint8_t color)
+{
+    uint8_t i, page;
+    uint64_t column, mask, moved, fill;
+
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+    if ((x + width) > DISPLAY_WIDTH) width = DISPLAY_WIDTH - x;
+    if ((y + height) > DISPLAY_HEIGHT) height = DISPLAY_HEIGHT - y;
+
+    // each column is handled as a 64 bits word, bit n is the row n
+    mask = ((height == 64) ? ~0ULL : ((1ULL << height) - 1)) << y;
+    moved = (rows > 0) ? ((mask << rows) & mask) : ((mask >> -rows) & mask);
+    fill = (color == KS0108_BLACK) ? (mask & ~moved) : 0;
+
+    for (i = 0; i < width; i++)
+    {
+        column = 0;
+        for (page = 0; page < (DISPLAY_HEIGHT/8); page++)
+            column |= ((uint64_t) READ_BUFFER(disp, x + i, page * 8)) << (page * 8);
+
+        if (rows > 0) column = (column & ~mask) | ((column << rows) & moved) | fill;
+        else column = (column & ~mask) | ((column >> -rows) & moved) | fill;
+
+        // only the pages of the region are written back
+        for (page = y / 8; page <= (y + height - 1) / 8; page++)
+        {
+            WRITE_BUFFER(disp, x + i, page * 8, (uint8_t) (column >> (page * 8)));
+        }
+    }
+}
+
+uint32_t ks0108_revision(ks0108_t *disp)
+{
+    return disp->revision;
+}
+
 void ks0108_text(ks0108_t *disp, uint8_t x, uint8_t y, const char *text, const uint8_t *font, uint8_t color)
 {
     uint8_t i, j, x_tmp, y_tmp, c, bytes, data;
@@ -659,3 +754,10 @@ void ks0108_update(ks0108_t *disp)
         }
     }
 }
+
+uint8_t ks0108_need_update(ks0108_t *disp)
+{
+    // this driver doesn't track the buffer changes
+    (void) disp;
+    return 1;
+}
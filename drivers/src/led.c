@@ -7,6 +7,9 @@
 
 #include "led.h"
 
+#include "FreeRTOS.h"
+#include "task.h"
+
 
 /*
 ************************************************************************************************************************
@@ -17,10 +20,14 @@
 #define __BLINK    0x01
 #define __STATE    0x02
 
-#define PWM_PERIOD      (((uint32_t)1E6) / (uint32_t)LEDS_PWM_CLOCK_Hz)
-//dirty fix to get taptempo LED in sync, determined by experimentation
-//was #define COUNT_PRESCALE ((uint32_t)1000 / PWM_PERIOD)
-#define COUNT_PRESCALE  (((uint32_t)1000 / (2*PWM_PERIOD)) - 2)
+// amount of bits of each color channel
+#define BCM_BITS    8
+
+// max number of GPIO ports used by the leds
+#define MAX_PORTS   5
+
+// registers of a GPIO port, the ports are 0x20 bytes apart
+#define GPIO_PORT(port)     ((LPC_GPIO_TypeDef *) (LPC_GPIO0_BASE + ((port) * 0x20)))
 
 
 /*
@@ -36,6 +43,11 @@
 ************************************************************************************************************************
 */
 
+// port writes of one modulation bit
+typedef struct LEDS_SLOT_T {
+    uint32_t set[MAX_PORTS], clr[MAX_PORTS];
+} leds_slot_t;
+
 
 /*
 ************************************************************************************************************************
@@ -44,22 +56,22 @@
 */
 
 #if defined LED_TURN_ON_WITH_ZERO
-#define R_ON(led)       CLR_PIN(led->pins.portR, led->pins.pinR)
-#define G_ON(led)       CLR_PIN(led->pins.portG, led->pins.pinG)
-#define B_ON(led)       CLR_PIN(led->pins.portB, led->pins.pinB)
-
 #define R_OFF(led)      SET_PIN(led->pins.portR, led->pins.pinR)
 #define G_OFF(led)      SET_PIN(led->pins.portG, led->pins.pinG)
 #define B_OFF(led)      SET_PIN(led->pins.portB, led->pins.pinB)
 
-#elif defined LED_TURN_ON_WITH_ONE
-#define R_ON(led)       SET_PIN(led->pins.portR, led->pins.pinR)
-#define G_ON(led)       SET_PIN(led->pins.portG, led->pins.pinG)
-#define B_ON(led)       SET_PIN(led->pins.portB, led->pins.pinB)
+// on/off masks of a port
+#define PINS_ON(slot)   (slot)->clr
+#define PINS_OFF(slot)  (slot)->set
 
+#elif defined LED_TURN_ON_WITH_ONE
 #define R_OFF(led)      CLR_PIN(led->pins.portR, led->pins.pinR)
 #define G_OFF(led)      CLR_PIN(led->pins.portG, led->pins.pinG)
 #define B_OFF(led)      CLR_PIN(led->pins.portB, led->pins.pinB)
+
+// on/off masks of a port
+#define PINS_ON(slot)   (slot)->set
+#define PINS_OFF(slot)  (slot)->clr
 #endif
 
 #define BLINK_ENABLE(led)       (led->control |= (__BLINK))
@@ -83,7 +95,14 @@
 
 static uint8_t g_leds_count;
 static led_t *g_leds[MAX_LEDS];
-static color_t g_colors[MAX_LEDS];
+
+// ports used by the leds and the precomputed writes of each modulation bit
+// the slots are double buffered, the modulation switches to the rebuilt table when a frame starts
+static uint8_t g_ports_count, g_ports[MAX_PORTS];
+static LPC_GPIO_TypeDef *g_gpios[MAX_PORTS];
+static leds_slot_t g_slots[2][BCM_BITS];
+static volatile uint8_t g_slots_front, g_slots_swap;
+static volatile uint8_t g_slots_outdated;
 
 
 /*
@@ -106,6 +125,127 @@ static color_t g_colors[MAX_LEDS];
 ************************************************************************************************************************
 */
 
+static uint8_t port_index(uint8_t port)
+{
+    uint8_t i;
+
+    for (i = 0; i < g_ports_count; i++)
+    {
+        if (g_ports[i] == port) return i;
+    }
+
+    if (g_ports_count < MAX_PORTS)
+    {
+        g_gpios[g_ports_count] = GPIO_PORT(port);
+        g_ports[g_ports_count++] = port;
+    }
+
+    return i;
+}
+
+static void slot_add_pin(leds_slot_t *slot, uint8_t port, uint8_t pin, uint8_t on)
+{
+    port = port_index(port);
+    if (port >= MAX_PORTS) return;
+
+    if (on) PINS_ON(slot)[port] |= (1 << pin);
+    else PINS_OFF(slot)[port] |= (1 << pin);
+}
+
+// rebuilds the table not shown, it's only called when the previous one was already taken
+static void slots_update(void)
+{
+    uint8_t i, bit, mask;
+    led_t *led;
+    leds_slot_t *slot;
+
+    for (bit = 0; bit < BCM_BITS; bit++)
+    {
+        slot = &g_slots[g_slots_front ^ 1][bit];
+        mask = (1 << bit);
+
+        for (i = 0; i < MAX_PORTS; i++)
+        {
+            slot->set[i] = 0;
+            slot->clr[i] = 0;
+        }
+
+        for (i = 0; i < g_leds_count; i++)
+        {
+            led = g_leds[i];
+            if (!led) continue;
+
+            slot_add_pin(slot, led->pins.portR, led->pins.pinR, (led->color.r & mask) && BLINK_CHECK(led));
+            slot_add_pin(slot, led->pins.portG, led->pins.pinG, (led->color.g & mask) && BLINK_CHECK(led));
+            slot_add_pin(slot, led->pins.portB, led->pins.pinB, (led->color.b & mask) && BLINK_CHECK(led));
+        }
+    }
+
+    g_slots_swap = 1;
+}
+
+static void ramp_steps(int32_t steps[3], const color_t from, const color_t to, uint16_t time_ms)
+{
+    if (time_ms == 0) time_ms = 1;
+
+    steps[0] = (((int32_t) to.r - from.r) << 16) / time_ms;
+    steps[1] = (((int32_t) to.g - from.g) << 16) / time_ms;
+    steps[2] = (((int32_t) to.b - from.b) << 16) / time_ms;
+}
+
+static void ramp_level(int32_t level[3], const color_t color)
+{
+    level[0] = ((int32_t) color.r) << 16;
+    level[1] = ((int32_t) color.g) << 16;
+    level[2] = ((int32_t) color.b) << 16;
+}
+
+// runs each 1ms, returns 1 if the color changed
+static uint8_t animation_clock(led_t *led)
+{
+    led_animation_t *anim = &led->animation;
+    const led_keyframe_t *frame = &anim->frames[anim->index];
+    const int32_t *steps;
+    color_t color = led->color;
+
+    if (anim->counter < frame->fade_ms)
+    {
+        steps = (anim->played == 0 && anim->index == 0) ? anim->first : anim->steps[anim->index];
+        anim->level[0] += steps[0];
+        anim->level[1] += steps[1];
+        anim->level[2] += steps[2];
+
+        // the last increment lands exactly on the keyframe
+        if ((anim->counter + 1) == frame->fade_ms) ramp_level(anim->level, frame->color);
+
+        led->color.r = anim->level[0] >> 16;
+        led->color.g = anim->level[1] >> 16;
+        led->color.b = anim->level[2] >> 16;
+    }
+    else if (anim->counter == 0)
+    {
+        led->color = frame->color;
+        ramp_level(anim->level, frame->color);
+    }
+
+    // next keyframe
+    if (++anim->counter >= (frame->fade_ms + frame->hold_ms))
+    {
+        anim->counter = 0;
+
+        if (++anim->index >= anim->count)
+        {
+            anim->index = 0;
+
+            // stops on the last keyframe after playing the requested times
+            if (anim->repeat == 0) anim->played = 1;
+            else if (++anim->played >= anim->repeat) led->animating = 0;
+        }
+    }
+
+    return (color.r != led->color.r || color.g != led->color.g || color.b != led->color.b);
+}
+
 
 /*
 ************************************************************************************************************************
@@ -132,11 +272,14 @@ void led_init(led_t *led, const led_pins_t pins)
 
     // store the configurations
     g_leds[g_leds_count] = led;
-    g_colors[g_leds_count] = BLACK;
     g_leds_count++;
+    port_index(pins.portR);
+    port_index(pins.portG);
+    port_index(pins.portB);
 
     // initialize the object configurations
     led->control = 0;
+    led->animating = 0;
     led->time_on = 0;
     led->time_off = 0;
     led->counter = 0;
@@ -146,6 +289,7 @@ void led_init(led_t *led, const led_pins_t pins)
     G_OFF(led);
     B_OFF(led);
     led->color = BLACK;
+    g_slots_outdated = 1;
 }
 
 
@@ -153,12 +297,63 @@ void led_set_color(led_t *led, const color_t color)
 {
     if (!led) return;
 
+    // the modulation slots are rebuilt by the next leds_clock()
+    led->animating = 0;
     led->color = color;
-    leds_clock();
+    g_slots_outdated = 1;
+}
+
+
+void led_animate(led_t *led, const led_keyframe_t *frames, uint8_t count, uint8_t repeat)
+{
+    if (!led || !frames || count == 0) return;
+    if (count > LED_MAX_KEYFRAMES) count = LED_MAX_KEYFRAMES;
+
+    uint8_t i;
+    led_animation_t anim;
+
+    // all ramps are computed here, the timer only accumulates them
+    for (i = 0; i < count; i++)
+    {
+        anim.frames[i] = frames[i];
+        ramp_steps(anim.steps[i], frames[(i > 0) ? (i - 1) : (count - 1)].color, frames[i].color, frames[i].fade_ms);
+    }
+
+    anim.count = count;
+    anim.index = 0;
+    anim.repeat = repeat;
+    anim.played = 0;
+    anim.counter = 0;
+
+    // leds_clock runs in the timer 1 interrupt, which is masked by the critical section
+    led->animating = 0;
+    taskENTER_CRITICAL();
+    ramp_steps(anim.first, led->color, frames[0].color, frames[0].fade_ms);
+    ramp_level(anim.level, led->color);
+    led->animation = anim;
+    led->animating = 1;
+    taskEXIT_CRITICAL();
+}
+
+
+void led_fade(led_t *led, const color_t color, uint16_t time_ms)
+{
+    led_keyframe_t frame;
+
+    frame.color = color;
+    frame.fade_ms = time_ms;
+    frame.hold_ms = 0;
+    led_animate(led, &frame, 1, 1);
 }
 
 
 void led_blink(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms)
+{
+    led_blink_phase(led, time_on_ms, time_off_ms, 0);
+}
+
+
+void led_blink_phase(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms, uint32_t elapsed_ms)
 {
     if (!led) return;
 
@@ -168,27 +363,31 @@ void led_blink(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms)
     led->time_off = time_off_ms;
     led->counter = time_on_ms;
 
-    // locate the led pointer
-    uint8_t i;
-    for (i = 0; i < g_leds_count; i++)
-    {
-        if (g_leds[i] == led) break;
-    }
-
-    // if not found returns
-    if (i >= g_leds_count) return;
-
     if (led->time_on > 0)
     {
-        // synchronizes the colors
-        g_colors[i] = BLACK;
-
         // set state on
         STATE_SET_ON(led);
 
+        // moves the counter to the elapsed time of the period
+        if (led->time_off > 0)
+        {
+            elapsed_ms %= (time_on_ms + time_off_ms);
+
+            if (elapsed_ms < time_on_ms)
+            {
+                led->counter = time_on_ms - elapsed_ms;
+            }
+            else
+            {
+                led->counter = time_on_ms + time_off_ms - elapsed_ms;
+                STATE_SET_OFF(led);
+            }
+        }
+
         // enables the blinker
         if (led->time_off > 0) BLINK_ENABLE(led);
 
+        g_slots_outdated = 1;
         return;
     }
 
@@ -198,70 +397,79 @@ void led_blink(led_t *led, uint16_t time_on_ms, uint16_t time_off_ms)
 }
 
 
+uint32_t leds_modulation(void)
+{
+    uint8_t i;
+    leds_slot_t *slot;
+    static uint8_t bit;
+
+    // binary code modulation: the bit n of each color is shown during 2^n time units
+    if (++bit >= BCM_BITS)
+    {
+        bit = 0;
+
+        // a rebuilt table is only shown from the start of a frame
+        if (g_slots_swap)
+        {
+            g_slots_front ^= 1;
+            g_slots_swap = 0;
+        }
+    }
+
+    slot = &g_slots[g_slots_front][bit];
+
+    // a single set and a single clear write per port
+    for (i = 0; i < g_ports_count; i++)
+    {
+        g_gpios[i]->FIOSET = slot->set[i];
+        g_gpios[i]->FIOCLR = slot->clr[i];
+    }
+
+    return (1 << bit);
+}
+
+
 void leds_clock(void)
 {
     uint8_t i;
     led_t *led;
-    static uint32_t count;
 
     for (i = 0; i < g_leds_count; i++)
     {
         led = g_leds[i];
         if (!led) continue;
 
-        // colors verification
-        if (led->color.r > 0 && led->color.r >= g_colors[i].r && BLINK_CHECK(led)) R_ON(led);
-        else R_OFF(led);
-
-        if (led->color.g > 0 && led->color.g >= g_colors[i].g && BLINK_CHECK(led)) G_ON(led);
-        else G_OFF(led);
-
-        if (led->color.b > 0 && led->color.b >= g_colors[i].b && BLINK_CHECK(led)) B_ON(led);
-        else B_OFF(led);
-
-        // increment each color (overflow expected)
-        g_colors[i].r++;
-        g_colors[i].g++;
-        g_colors[i].b++;
-
-        // only go ahead if passed 1ms
-        if (count < COUNT_PRESCALE) continue;
+        // keyframes animation
+        if (led->animating && animation_clock(led)) g_slots_outdated = 1;
 
         // blink time verification
-        if (BLINK_IS_ENABLED(led))
+        if (BLINK_IS_DISABLED(led)) continue;
+
+        if (led->counter > 0)
         {
-            if (led->counter > 0)
-            {
-                led->counter--;
-            }
-            else
-            {
-                if (STATE_IS_ON(led))
-                {
-                    // load the counter with time off
-                    led->counter = led->time_off;
-
-                    // turn off the leds and set state
-                    STATE_SET_OFF(led);
-                    R_OFF(led);
-                    G_OFF(led);
-                    B_OFF(led);
-                }
-                else
-                {
-                    // load the counter with time on
-                    led->counter = led->time_on;
-
-                    // turn on the leds and set state
-                    STATE_SET_ON(led);
-                    led_set_color(led, led->color);
-
-                    // synchronizes the colors
-                    g_colors[i] = BLACK;
-                }
-            }
+            led->counter--;
+        }
+        else if (STATE_IS_ON(led))
+        {
+            // load the counter with time off
+            led->counter = led->time_off;
+            STATE_SET_OFF(led);
+            g_slots_outdated = 1;
+        }
+        else
+        {
+            // load the counter with time on
+            led->counter = led->time_on;
+            STATE_SET_ON(led);
+            g_slots_outdated = 1;
         }
     }
 
-    if (count++ >= COUNT_PRESCALE) count = 0;
+    // the flag is cleared first so a change made meanwhile is not lost
+    // the rebuild waits while the modulation didn't take the previous table yet
+    if (g_slots_outdated && !g_slots_swap)
+    {
+        g_slots_outdated = 0;
+        slots_update();
+    }
 }
@@ -50,6 +50,7 @@
 #define READ_BUFFER(disp,x,y)           disp->buffer[(y)/8][(DISPLAY_WIDTH-1)-(x)]
 #define WRITE_BUFFER(disp,x,y,data)     disp->buffer[(y)/8][(DISPLAY_WIDTH-1)-(x)] = (data); \
                                         disp->status |= NEED_UPDATE; \
+                                        disp->revision++; \
                                         if (disp->status & UPDATING) disp->status |= FORCE_REFRESH;
 
 // general purpose macros
@@ -306,6 +307,7 @@ void uc1701_clear(uc1701_t *disp, uint8_t color)
     }
 
     disp->status |= NEED_UPDATE;
+    disp->revision++;
 }
 
 void uc1701_update(uc1701_t *disp)
@@ -347,6 +349,11 @@ void uc1701_update(uc1701_t *disp)
     }
 }
 
+uint8_t uc1701_need_update(uc1701_t *disp)
+{
+    return (disp->status & NEED_UPDATE) ? 1 : 0;
+}
+
 void uc1701_set_pixel(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t color)
 {
     // avoid x, y be out of the bounds
@@ -567,6 +574,101 @@ void uc1701_draw_image(uc1701_t *disp, uint8_t x, uint8_t y, const uint8_t *imag
     }
 }
 
+void uc1701_draw_image_rle(uc1701_t *disp, uint8_t x, uint8_t y, const uint8_t *image, uint16_t size, uint8_t color)
+{
+    uint8_t width, height, clip_width, clip_height, op, count, data = 0;
+    uint16_t pos, total, col, row;
+    const uint8_t *end = image + size;
+
+    if (size < 2) return;
+
+    width = (uint8_t) *image++;
+    height = (uint8_t) *image++;
+
+    // the position and size may come from webgui, the image is clipped to the display
+    if (width == 0 || x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+    clip_width = ((x + width) > DISPLAY_WIDTH) ? (DISPLAY_WIDTH - x) : width;
+    clip_height = ((y + height) > DISPLAY_HEIGHT) ? (DISPLAY_HEIGHT - y) : height;
+
+    total = width * ((height + 7) / 8);
+
+    // the data is decoded straight into the display buffer, a truncated image stops where its data ends
+    for (pos = 0; pos < total && image < end;)
+    {
+        op = *image++;
+
+        if ((op & UC1701_RLE_OP_MASK) == UC1701_RLE_SKIP)
+        {
+            pos += (op & ~UC1701_RLE_OP_MASK) + 1;
+            continue;
+        }
+
+        if (op & UC1701_RLE_REPEAT)
+        {
+            if (image >= end) return;
+            count = (op & ~UC1701_RLE_OP_MASK) + 1;
+            data = *image++;
+        }
+        else
+        {
+            count = op + 1;
+        }
+
+        for (; count > 0 && pos < total; count--, pos++)
+        {
+            if (!(op & UC1701_RLE_REPEAT))
+            {
+                if (image >= end) return;
+                data = *image++;
+            }
+
+            // the bytes out of the display are decoded but not written
+            col = pos % width;
+            row = (pos / width) * 8;
+            if (col < clip_width && row < clip_height)
+            {
+                WRITE_BUFFER(disp, x + col, y + row, (color == UC1701_WHITE) ? (uint8_t) ~data : data);
+            }
+        }
+    }
+}
+
+void uc1701_vscroll(uc1701_t *disp, uint8_t x, uint8_t y, uint8_t width, uint8_t height, int8_t rows, uint8_t color)
+{
+    uint8_t i, page;
+    uint64_t column, mask, moved, fill;
+
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return;
+    if ((x + width) > DISPLAY_WIDTH) width = DISPLAY_WIDTH - x;
+    if ((y + height) > DISPLAY_HEIGHT) height = DISPLAY_HEIGHT - y;
+
+    // each column is handled as a 64 bits word, bit n is the row n
+    mask = ((height == 64) ? ~0ULL : ((1ULL << height) - 1)) << y;
+    moved = (rows > 0) ? ((mask << rows) & mask) : ((mask >> -rows) & mask);
+    fill = (color == UC1701_BLACK) ? (mask & ~moved) : 0;
+
+    for (i = 0; i < width; i++)
+    {
+        column = 0;
+        for (page = 0; page < (DISPLAY_HEIGHT/8); page++)
+            column |= ((uint64_t) READ_BUFFER(disp, x + i, page * 8)) << (page * 8);
+
+        if (rows > 0) column = (column & ~mask) | ((column << rows) & moved) | fill;
+        else column = (column & ~mask) | ((column >> -rows) & moved) | fill;
+
+        // only the pages of the region are written back
+        for (page = y / 8; page <= (y + height - 1) / 8; page++)
+        {
+            WRITE_BUFFER(disp, x + i, page * 8, (uint8_t) (column >> (page * 8)));
+        }
+    }
+}
+
+uint32_t uc1701_revision(uc1701_t *disp)
+{
+    return disp->revision;
+}
+
 void uc1701_text(uc1701_t *disp, uint8_t x, uint8_t y, const char *text, const uint8_t *font, uint8_t color)
 {
     uint8_t i, j, x_tmp, y_tmp, c, bytes, data;